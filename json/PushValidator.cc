@@ -0,0 +1,472 @@
+/*
+    PushValidator.cc -- validate a document as its text arrives in chunks
+    Copyright 2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <json/PushValidator.h>
+
+#include <cmath>
+#include <limits>
+#include <locale>
+#include <sstream>
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+PushValidator::PushValidator(const SchemaValidator &validator, std::vector<SchemaValidator::Error> *errors) : errors_(errors), stream_(validator, errors), syntax_error_(false), state_(STATE_VALUE), token_(TOKEN_NONE), string_is_key_(false), escape_(0), code_(0), high_surrogate_(0), line_(1), column_(1) {
+}
+
+
+bool PushValidator::feed(const char *data, size_t length) {
+    for (size_t i = 0; i < length && !stopped(); i++) {
+        parse(data[i]);
+        if (data[i] == '\n') {
+            line_++;
+            column_ = 1;
+        }
+        else {
+            column_++;
+        }
+    }
+
+    return is_valid();
+}
+
+
+bool PushValidator::finish() {
+    if (stopped()) {
+        return false;
+    }
+
+    switch (token_) {
+        case TOKEN_NUMBER:
+            end_number();
+            break;
+
+        case TOKEN_LITERAL:
+            end_literal();
+            break;
+
+        case TOKEN_STRING:
+            syntax_error("Missing '\"' at end of string");
+            break;
+
+        case TOKEN_NONE:
+            break;
+    }
+
+    if (!syntax_error_ && state_ != STATE_END) {
+        syntax_error(state_ == STATE_VALUE && containers_.empty() ? "Syntax error: value, object or array expected." : "Unexpected end of document");
+    }
+
+    return is_valid();
+}
+
+
+void PushValidator::parse(char c) {
+    switch (token_) {
+        case TOKEN_STRING:
+            parse_string(c);
+            return;
+
+        case TOKEN_NUMBER:
+            if ((c >= '0' && c <= '9') || c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') {
+                text_ += c;
+                return;
+            }
+            end_number();
+            break;
+
+        case TOKEN_LITERAL:
+            if (c >= 'a' && c <= 'z') {
+                text_ += c;
+                return;
+            }
+            end_literal();
+            break;
+
+        case TOKEN_NONE:
+            break;
+    }
+
+    if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || stopped()) {
+        return;
+    }
+
+    switch (state_) {
+        case STATE_VALUE:
+        case STATE_FIRST_ITEM:
+            if (c == ']' && state_ == STATE_FIRST_ITEM) {
+                end_container(c);
+            }
+            else if (c == '{') {
+                stream_.start_object();
+                containers_ += c;
+                state_ = STATE_FIRST_KEY;
+            }
+            else if (c == '[') {
+                stream_.start_array();
+                containers_ += c;
+                state_ = STATE_FIRST_ITEM;
+            }
+            else if (c == '"') {
+                token_ = TOKEN_STRING;
+                string_is_key_ = false;
+                text_.clear();
+            }
+            else if (c == '-' || (c >= '0' && c <= '9')) {
+                token_ = TOKEN_NUMBER;
+                text_.assign(1, c);
+            }
+            else if (c >= 'a' && c <= 'z') {
+                token_ = TOKEN_LITERAL;
+                text_.assign(1, c);
+            }
+            else {
+                syntax_error("Syntax error: value, object or array expected.");
+            }
+            break;
+
+        case STATE_FIRST_KEY:
+        case STATE_KEY:
+            if (c == '"') {
+                token_ = TOKEN_STRING;
+                string_is_key_ = true;
+                text_.clear();
+            }
+            else if (c == '}' && state_ == STATE_FIRST_KEY) {
+                end_container(c);
+            }
+            else {
+                syntax_error("Missing '}' or object member name");
+            }
+            break;
+
+        case STATE_COLON:
+            if (c == ':') {
+                state_ = STATE_VALUE;
+            }
+            else {
+                syntax_error("Missing ':' after object member name");
+            }
+            break;
+
+        case STATE_AFTER_VALUE:
+            if (containers_.back() == '{') {
+                if (c == ',') {
+                    state_ = STATE_KEY;
+                }
+                else if (c == '}') {
+                    end_container(c);
+                }
+                else {
+                    syntax_error("Missing ',' or '}' in object declaration");
+                }
+            }
+            else {
+                if (c == ',') {
+                    state_ = STATE_VALUE;
+                }
+                else if (c == ']') {
+                    end_container(c);
+                }
+                else {
+                    syntax_error("Missing ',' or ']' in array declaration");
+                }
+            }
+            break;
+
+        case STATE_END:
+            syntax_error("Extra non-whitespace after JSON value.");
+            break;
+    }
+}
+
+
+void PushValidator::parse_string(char c) {
+    if (escape_ == 0) {
+        if (high_surrogate_ != 0 && c != '\\') {
+            syntax_error("expecting another \\u token to begin the second half of a unicode surrogate pair");
+        }
+        else if (c == '"') {
+            end_string();
+        }
+        else if (c == '\\') {
+            escape_ = 1;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20) {
+            syntax_error("Control character in string");
+        }
+        else {
+            text_ += c;
+        }
+        return;
+    }
+
+    if (escape_ == 1) {
+        escape_ = 0;
+        if (high_surrogate_ != 0 && c != 'u') {
+            syntax_error("expecting another \\u token to begin the second half of a unicode surrogate pair");
+            return;
+        }
+        switch (c) {
+            case '"':
+            case '\\':
+            case '/':
+                text_ += c;
+                break;
+            case 'b':
+                text_ += '\b';
+                break;
+            case 'f':
+                text_ += '\f';
+                break;
+            case 'n':
+                text_ += '\n';
+                break;
+            case 'r':
+                text_ += '\r';
+                break;
+            case 't':
+                text_ += '\t';
+                break;
+            case 'u':
+                escape_ = 2;
+                code_ = 0;
+                break;
+            default:
+                syntax_error("Bad escape sequence in string");
+                break;
+        }
+        return;
+    }
+
+    unsigned int digit;
+    if (c >= '0' && c <= '9') {
+        digit = static_cast<unsigned int>(c - '0');
+    }
+    else if (c >= 'a' && c <= 'f') {
+        digit = static_cast<unsigned int>(c - 'a' + 10);
+    }
+    else if (c >= 'A' && c <= 'F') {
+        digit = static_cast<unsigned int>(c - 'A' + 10);
+    }
+    else {
+        syntax_error("Bad unicode escape sequence in string: hexadecimal digit expected.");
+        return;
+    }
+    code_ = code_ * 16 + digit;
+    if (++escape_ < 6) {
+        return;
+    }
+    escape_ = 0;
+
+    if (high_surrogate_ != 0) {
+        if (code_ < 0xdc00 || code_ > 0xdfff) {
+            syntax_error("expecting another \\u token to begin the second half of a unicode surrogate pair");
+            return;
+        }
+        append_utf8(0x10000 + ((high_surrogate_ - 0xd800) << 10) + (code_ - 0xdc00));
+        high_surrogate_ = 0;
+    }
+    else if (code_ >= 0xd800 && code_ <= 0xdbff) {
+        high_surrogate_ = code_;
+    }
+    else if (code_ >= 0xdc00 && code_ <= 0xdfff) {
+        syntax_error("Bad unicode escape sequence in string: unexpected second half of a surrogate pair.");
+    }
+    else {
+        append_utf8(code_);
+    }
+}
+
+
+void PushValidator::end_string() {
+    token_ = TOKEN_NONE;
+    if (string_is_key_) {
+        stream_.key(text_);
+        state_ = STATE_COLON;
+    }
+    else {
+        stream_.value(Json::Value(text_.data(), text_.data() + text_.length()));
+        end_value();
+    }
+}
+
+
+void PushValidator::end_number() {
+    token_ = TOKEN_NONE;
+
+    // -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+    size_t i = 0;
+    auto digits = [&]() {
+        auto start = i;
+        while (i < text_.length() && text_[i] >= '0' && text_[i] <= '9') {
+            i++;
+        }
+        return i - start;
+    };
+    auto negative = text_[0] == '-';
+    if (negative) {
+        i++;
+    }
+    auto integer_start = i;
+    auto integer_digits = digits();
+    auto valid = integer_digits > 0 && (integer_digits == 1 || text_[integer_start] != '0');
+    auto integral = true;
+    if (valid && i < text_.length() && text_[i] == '.') {
+        i++;
+        integral = false;
+        valid = digits() > 0;
+    }
+    if (valid && i < text_.length() && (text_[i] == 'e' || text_[i] == 'E')) {
+        i++;
+        integral = false;
+        if (i < text_.length() && (text_[i] == '+' || text_[i] == '-')) {
+            i++;
+        }
+        valid = digits() > 0;
+    }
+    if (!valid || i != text_.length()) {
+        syntax_error("'" + text_ + "' is not a number.");
+        return;
+    }
+
+    // Same types as Json::Reader: Int64 if it fits, then UInt64, then double.
+    if (integral) {
+        Json::UInt64 magnitude = 0;
+        auto overflow = false;
+        for (i = integer_start; i < text_.length(); i++) {
+            Json::UInt64 digit = static_cast<Json::UInt64>(text_[i] - '0');
+            if (magnitude > (std::numeric_limits<Json::UInt64>::max() - digit) / 10) {
+                overflow = true;
+                break;
+            }
+            magnitude = magnitude * 10 + digit;
+        }
+        const auto max_int = static_cast<Json::UInt64>(std::numeric_limits<Json::Int64>::max());
+        if (!overflow) {
+            if (negative && magnitude <= max_int + 1) {
+                stream_.value(magnitude == max_int + 1 ? Json::Value(std::numeric_limits<Json::Int64>::min()) : Json::Value(-static_cast<Json::Int64>(magnitude)));
+                end_value();
+                return;
+            }
+            if (!negative) {
+                stream_.value(magnitude <= max_int ? Json::Value(static_cast<Json::Int64>(magnitude)) : Json::Value(magnitude));
+                end_value();
+                return;
+            }
+        }
+    }
+
+    std::istringstream is(text_);
+    is.imbue(std::locale::classic());
+    double value = 0;
+    // Out of range, like Json::Reader.
+    if (!(is >> value) || !std::isfinite(value)) {
+        syntax_error("'" + text_ + "' is not a number.");
+        return;
+    }
+    stream_.value(Json::Value(value));
+    end_value();
+}
+
+
+void PushValidator::end_literal() {
+    token_ = TOKEN_NONE;
+
+    if (text_ == "true") {
+        stream_.value(Json::Value(true));
+    }
+    else if (text_ == "false") {
+        stream_.value(Json::Value(false));
+    }
+    else if (text_ == "null") {
+        stream_.value(Json::Value());
+    }
+    else {
+        syntax_error("Syntax error: value, object or array expected.");
+        return;
+    }
+    end_value();
+}
+
+
+void PushValidator::end_value() {
+    state_ = containers_.empty() ? STATE_END : STATE_AFTER_VALUE;
+}
+
+
+void PushValidator::end_container(char close) {
+    containers_.pop_back();
+    if (close == '}') {
+        stream_.end_object();
+    }
+    else {
+        stream_.end_array();
+    }
+    end_value();
+}
+
+
+void PushValidator::append_utf8(unsigned int code) {
+    if (code < 0x80) {
+        text_ += static_cast<char>(code);
+    }
+    else if (code < 0x800) {
+        text_ += static_cast<char>(0xc0 | (code >> 6));
+        text_ += static_cast<char>(0x80 | (code & 0x3f));
+    }
+    else if (code < 0x10000) {
+        text_ += static_cast<char>(0xe0 | (code >> 12));
+        text_ += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+        text_ += static_cast<char>(0x80 | (code & 0x3f));
+    }
+    else {
+        text_ += static_cast<char>(0xf0 | (code >> 18));
+        text_ += static_cast<char>(0x80 | ((code >> 12) & 0x3f));
+        text_ += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+        text_ += static_cast<char>(0x80 | (code & 0x3f));
+    }
+}
+
+
+// Reports a syntax error at the current position, parsing stops.
+void PushValidator::syntax_error(const std::string &message) {
+    syntax_error_ = true;
+    if (errors_ != NULL) {
+        errors_->push_back(SchemaValidator::Error("", "line " + std::to_string(line_) + ", column " + std::to_string(column_) + ": " + message));
+    }
+}
+
+}
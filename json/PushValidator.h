@@ -0,0 +1,135 @@
+/*
+    PushValidator.h -- validate a document as its text arrives in chunks
+    Copyright 2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef JSON_PUSH_VALIDATOR_H
+#define JSON_PUSH_VALIDATOR_H
+
+#include <string>
+#include <vector>
+
+#include <json/json.h>
+#include <json/SchemaValidator.h>
+#include <json/StreamValidator.h>
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+/*
+  Parses and validates one JSON document while its text arrives, in
+  chunks split at arbitrary bytes. The parser keeps its state between
+  chunks and reports the document to a StreamValidator, so neither the
+  text nor a Json::Value of it is kept in memory.
+
+  A violation of the schema is known as soon as the part of the document
+  it concerns has been fed, so the caller can stop reading early.
+
+  The text must be strict JSON (RFC 8259): comments are not allowed.
+*/
+class PushValidator {
+public:
+    // |validator| must outlive the push validator. Syntax errors and violations of the schema are
+    // added to |errors|; with NULL, parsing stops at the first one.
+    explicit PushValidator(const SchemaValidator &validator, std::vector<SchemaValidator::Error> *errors = NULL);
+
+    // Parses and validates the next |length| bytes of the document. Returns false once the
+    // document is known to be invalid.
+    bool feed(const char *data, size_t length);
+    bool feed(const std::string &data) { return feed(data.data(), data.length()); }
+    // Ends the document. Returns whether it is complete, well formed and valid.
+    bool finish();
+
+    // Whether no syntax error or violation of the schema was found so far.
+    bool is_valid() const { return !syntax_error_ && stream_.is_valid(); }
+    // Whether the remaining text can't change the result.
+    bool stopped() const { return syntax_error_ || stream_.stopped(); }
+
+private:
+    // What the parser expects next, outside of tokens.
+    enum State {
+        STATE_VALUE,
+        STATE_FIRST_ITEM, // value or ']'
+        STATE_FIRST_KEY,  // member name or '}'
+        STATE_KEY,
+        STATE_COLON,
+        STATE_AFTER_VALUE, // ',' or end of the enclosing object or array
+        STATE_END
+    };
+
+    // Token being read.
+    enum Token {
+        TOKEN_NONE,
+        TOKEN_STRING,
+        TOKEN_NUMBER,
+        TOKEN_LITERAL
+    };
+
+    PushValidator(const PushValidator &);
+    PushValidator &operator=(const PushValidator &);
+
+    void parse(char c);
+    void parse_string(char c);
+    void end_string();
+    void end_number();
+    void end_literal();
+    void end_value();
+    void end_container(char close);
+    void append_utf8(unsigned int code);
+    void syntax_error(const std::string &message);
+
+    std::vector<SchemaValidator::Error> *errors_;
+    StreamValidator stream_;
+    bool syntax_error_;
+
+    State state_;
+    Token token_;
+    // Text of the current token, decoded for strings.
+    std::string text_;
+    bool string_is_key_;
+    // In strings: 0 outside of escapes, 1 after '\', 2 to 5 in \u before each hex digit.
+    int escape_;
+    unsigned int code_;
+    // Leading surrogate of a \u escaped pair, 0 if none.
+    unsigned int high_surrogate_;
+    // Open objects and arrays, '{' or '['.
+    std::string containers_;
+
+    // Position of the next byte, for error messages.
+    size_t line_;
+    size_t column_;
+};
+
+}
+
+#endif // JSON_PUSH_VALIDATOR_H
@@ -0,0 +1,225 @@
+/*
+    Regex-pcre2.cc -- regular expressions using PCRE2
+    Copyright 2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <json/Regex.h>
+
+#define PCRE2_CODE_UNIT_WIDTH 8
+#include <pcre2.h>
+
+/*
+  Patterns are JIT compiled where PCRE2 supports it, pcre2_match() falls
+  back to the interpreter otherwise. The match limit applies to both, the
+  depth limit only to the interpreter; the JIT is bounded by its stack.
+
+  Match data is kept per thread and reused, so matching allocates no
+  memory.
+*/
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+class Regex::Implementation {
+public:
+    Implementation() : code(NULL), context(NULL), captures(0) { }
+    ~Implementation();
+
+    pcre2_code *code;
+    pcre2_match_context *context;
+    uint32_t captures;
+};
+
+
+namespace {
+class MatchData {
+public:
+    MatchData() : data(NULL), pairs(0) { }
+    ~MatchData() { if (data != NULL) { pcre2_match_data_free(data); } }
+
+    pcre2_match_data *get(uint32_t needed_pairs);
+
+private:
+    pcre2_match_data *data;
+    uint32_t pairs;
+};
+
+thread_local MatchData match_data;
+}
+
+
+pcre2_match_data *MatchData::get(uint32_t needed_pairs) {
+    if (needed_pairs > pairs) {
+        if (data != NULL) {
+            pcre2_match_data_free(data);
+        }
+        data = pcre2_match_data_create(needed_pairs, NULL);
+        pairs = data != NULL ? needed_pairs : 0;
+    }
+    return data;
+}
+
+
+Regex::Implementation::~Implementation() {
+    if (context != NULL) {
+        pcre2_match_context_free(context);
+    }
+    if (code != NULL) {
+        pcre2_code_free(code);
+    }
+}
+
+
+Regex::Regex(const std::string &pattern, unsigned long match_limit, unsigned long depth_limit) : implementation_(new Implementation()), simple_(SIMPLE_NONE), anchored_end_(false) {
+    int error_code;
+    PCRE2_SIZE error_offset;
+
+    implementation_->code = pcre2_compile(reinterpret_cast<PCRE2_SPTR>(pattern.data()), pattern.length(), 0, &error_code, &error_offset, NULL);
+    if (implementation_->code == NULL) {
+        PCRE2_UCHAR message[256];
+        pcre2_get_error_message(error_code, message, sizeof(message));
+        error_ = reinterpret_cast<const char *>(message);
+        return;
+    }
+
+    // Failure only means matching uses the interpreter.
+    pcre2_jit_compile(implementation_->code, PCRE2_JIT_COMPLETE);
+
+    pcre2_pattern_info(implementation_->code, PCRE2_INFO_CAPTURECOUNT, &implementation_->captures);
+
+    if (match_limit > 0 || depth_limit > 0) {
+        implementation_->context = pcre2_match_context_create(NULL);
+        if (match_limit > 0) {
+            pcre2_set_match_limit(implementation_->context, static_cast<uint32_t>(match_limit));
+        }
+        if (depth_limit > 0) {
+            pcre2_set_depth_limit(implementation_->context, static_cast<uint32_t>(depth_limit));
+        }
+    }
+
+    init_simple(pattern);
+}
+
+
+Regex::~Regex() {
+}
+
+
+bool Regex::search_library(const char *subject, size_t length) const {
+    if (implementation_->code == NULL) {
+        return false;
+    }
+
+    auto data = match_data.get(1);
+    if (data == NULL) {
+        return false;
+    }
+
+    // A return value of 0 means the match data is too small for the captures, which we don't need.
+    return pcre2_match(implementation_->code, reinterpret_cast<PCRE2_SPTR>(subject), length, 0, 0, data, implementation_->context) >= 0;
+}
+
+
+bool Regex::match(const std::string &subject, std::vector<std::string> *groups) const {
+    if (implementation_->code == NULL) {
+        return false;
+    }
+
+    auto data = match_data.get(implementation_->captures + 1);
+    if (data == NULL) {
+        return false;
+    }
+
+    if (pcre2_match(implementation_->code, reinterpret_cast<PCRE2_SPTR>(subject.data()), subject.length(), 0, PCRE2_ANCHORED | PCRE2_ENDANCHORED, data, implementation_->context) < 0) {
+        return false;
+    }
+
+    auto ovector = pcre2_get_ovector_pointer(data);
+    groups->clear();
+    for (uint32_t i = 1; i <= implementation_->captures; i++) {
+        if (ovector[2 * i] == PCRE2_UNSET) {
+            groups->push_back("");
+        }
+        else {
+            groups->push_back(subject.substr(ovector[2 * i], ovector[2 * i + 1] - ovector[2 * i]));
+        }
+    }
+
+    return true;
+}
+
+
+void Regex::replace_all(const std::string &replacement, std::string *subject) const {
+    if (implementation_->code == NULL) {
+        return;
+    }
+
+    auto data = match_data.get(1);
+    if (data == NULL) {
+        return;
+    }
+
+    std::string result;
+    size_t copied = 0;
+    size_t offset = 0;
+
+    while (offset <= subject->length()) {
+        if (pcre2_match(implementation_->code, reinterpret_cast<PCRE2_SPTR>(subject->data()), subject->length(), offset, 0, data, implementation_->context) < 0) {
+            break;
+        }
+        auto ovector = pcre2_get_ovector_pointer(data);
+
+        result.append(*subject, copied, ovector[0] - copied);
+        result.append(replacement);
+        copied = ovector[1];
+
+        if (ovector[1] == ovector[0]) {
+            // Empty match, continue after the next character.
+            if (ovector[1] == subject->length()) {
+                break;
+            }
+            result.append(*subject, ovector[1], 1);
+            copied = offset = ovector[1] + 1;
+        }
+        else {
+            offset = ovector[1];
+        }
+    }
+
+    if (copied > 0) {
+        result.append(*subject, copied, std::string::npos);
+        *subject = result;
+    }
+}
+
+}
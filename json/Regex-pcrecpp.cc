@@ -0,0 +1,106 @@
+/*
+    Regex-pcrecpp.cc -- regular expressions using pcrecpp
+    Copyright 2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <json/Regex.h>
+
+#include <pcrecpp.h>
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+class Regex::Implementation {
+public:
+    Implementation(const std::string &pattern, const pcrecpp::RE_Options &options) : re(pattern, options) { }
+
+    pcrecpp::RE re;
+};
+
+
+static pcrecpp::RE_Options make_options(unsigned long match_limit, unsigned long depth_limit) {
+    pcrecpp::RE_Options options;
+
+    if (match_limit > 0) {
+        options.set_match_limit(static_cast<int>(match_limit));
+    }
+    if (depth_limit > 0) {
+        options.set_match_limit_recursion(static_cast<int>(depth_limit));
+    }
+
+    return options;
+}
+
+
+Regex::Regex(const std::string &pattern, unsigned long match_limit, unsigned long depth_limit) : implementation_(new Implementation(pattern, make_options(match_limit, depth_limit))), error_(implementation_->re.error()), simple_(SIMPLE_NONE), anchored_end_(false) {
+    if (error_.empty()) {
+        init_simple(pattern);
+    }
+}
+
+
+Regex::~Regex() {
+}
+
+
+bool Regex::search_library(const char *subject, size_t length) const {
+    return implementation_->re.PartialMatch(pcrecpp::StringPiece(subject, static_cast<int>(length)));
+}
+
+
+bool Regex::match(const std::string &subject, std::vector<std::string> *groups) const {
+    auto captures = implementation_->re.NumberOfCapturingGroups();
+    if (captures < 0) {
+        return false;
+    }
+
+    groups->assign(captures, "");
+    std::vector<pcrecpp::Arg> args;
+    std::vector<const pcrecpp::Arg *> arg_pointers;
+    for (auto &group : *groups) {
+        args.push_back(pcrecpp::Arg(&group));
+    }
+    for (auto &arg : args) {
+        arg_pointers.push_back(&arg);
+    }
+
+    int consumed;
+    return implementation_->re.DoMatch(subject, pcrecpp::RE::ANCHOR_BOTH, &consumed, arg_pointers.data(), captures);
+}
+
+
+void Regex::replace_all(const std::string &replacement, std::string *subject) const {
+    implementation_->re.GlobalReplace(replacement, subject);
+}
+
+}
@@ -0,0 +1,416 @@
+/*
+    Regex.cc -- regular expressions, matching simple patterns
+    Copyright 2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <json/Regex.h>
+
+#include <ctype.h>
+#include <string.h>
+
+#include <algorithm>
+#include <limits>
+
+/*
+  Most patterns in schemata are literals or anchored sequences of
+  character classes, like "^[a-z0-9_]+$", "^prefix", "suffix$" or
+  "^[0-9a-f]{32}$". These are matched directly with memcmp or a lookup
+  table per character instead of calling the regex library.
+
+  Recognized syntax: ^ at the start, $ at the end, literal characters,
+  escaped punctuation, \n \r \t \f \v, ., \d \D \s \S \w \W, character
+  classes with ranges, and the greedy quantifiers * + ? {n} {n,} {n,m}.
+  Everything else, including any non-ASCII byte, goes to the regex
+  library.
+
+  Matching follows PCRE without options: characters are bytes, . doesn't
+  match newline, and $ also matches before a newline at the end of the
+  subject.
+
+  A sequence is matched greedily without backtracking. This is only
+  correct if no character class of variable length shares characters
+  with a class after it, otherwise the pattern is not treated as simple.
+*/
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+namespace {
+const size_t kUnlimited = std::numeric_limits<size_t>::max();
+
+void set_range(bool *chars, unsigned char first, unsigned char last, bool value) {
+    for (unsigned int c = first; c <= last; c++) {
+        chars[c] = value;
+    }
+}
+
+// Adds the class of escape sequence \|c| to |chars|, returns false if |c| is not supported.
+bool add_escape(bool *chars, char c) {
+    bool negated = false;
+    bool members[256] = { false };
+
+    switch (c) {
+        case 'D':
+            negated = true;
+            // fallthrough
+        case 'd':
+            set_range(members, '0', '9', true);
+            break;
+
+        case 'S':
+            negated = true;
+            // fallthrough
+        case 's':
+            set_range(members, '\t', '\r', true);
+            members[static_cast<unsigned char>(' ')] = true;
+            break;
+
+        case 'W':
+            negated = true;
+            // fallthrough
+        case 'w':
+            set_range(members, '0', '9', true);
+            set_range(members, 'A', 'Z', true);
+            set_range(members, 'a', 'z', true);
+            members[static_cast<unsigned char>('_')] = true;
+            break;
+
+        case 'n':
+            chars[static_cast<unsigned char>('\n')] = true;
+            return true;
+
+        case 'r':
+            chars[static_cast<unsigned char>('\r')] = true;
+            return true;
+
+        case 't':
+            chars[static_cast<unsigned char>('\t')] = true;
+            return true;
+
+        case 'f':
+            chars[static_cast<unsigned char>('\f')] = true;
+            return true;
+
+        case 'v':
+            chars[static_cast<unsigned char>('\v')] = true;
+            return true;
+
+        default:
+            // Escaped punctuation is literal, escaped letters and digits have special meanings.
+            if (static_cast<unsigned char>(c) < 0x80 && ispunct(static_cast<unsigned char>(c))) {
+                chars[static_cast<unsigned char>(c)] = true;
+                return true;
+            }
+            return false;
+    }
+
+    for (unsigned int i = 0; i < 256; i++) {
+        if (members[i] != negated) {
+            chars[i] = true;
+        }
+    }
+    return true;
+}
+
+// Parses the character class starting after '[' at |*i|, leaves |*i| after the closing ']'.
+bool parse_class(const std::string &pattern, size_t *i, bool *chars) {
+    size_t pos = *i;
+    bool negated = false;
+    bool members[256] = { false };
+
+    if (pos < pattern.length() && pattern[pos] == '^') {
+        negated = true;
+        pos++;
+    }
+
+    bool first = true;
+    while (pos < pattern.length() && (pattern[pos] != ']' || first)) {
+        first = false;
+        auto c = static_cast<unsigned char>(pattern[pos]);
+
+        if (c >= 0x80 || (c == '[' && pos + 1 < pattern.length() && (pattern[pos + 1] == ':' || pattern[pos + 1] == '.' || pattern[pos + 1] == '='))) {
+            // non-ASCII, POSIX class or collating element
+            return false;
+        }
+
+        if (c == '\\') {
+            if (pos + 1 >= pattern.length() || !add_escape(members, pattern[pos + 1])) {
+                return false;
+            }
+            if (pos + 2 < pattern.length() && pattern[pos + 2] == '-' && pos + 3 < pattern.length() && pattern[pos + 3] != ']') {
+                // range starting with an escape
+                return false;
+            }
+            pos += 2;
+            continue;
+        }
+
+        if (pos + 2 < pattern.length() && pattern[pos + 1] == '-' && pattern[pos + 2] != ']') {
+            auto last = static_cast<unsigned char>(pattern[pos + 2]);
+            if (last == '\\' || last == '[' || last >= 0x80 || last < c) {
+                return false;
+            }
+            set_range(members, c, last, true);
+            pos += 3;
+            continue;
+        }
+
+        members[c] = true;
+        pos++;
+    }
+
+    if (pos >= pattern.length()) {
+        return false;
+    }
+
+    for (unsigned int c = 0; c < 256; c++) {
+        if (members[c] != negated) {
+            chars[c] = true;
+        }
+    }
+    *i = pos + 1;
+    return true;
+}
+
+// Parses a quantifier at |*i|, if any.
+bool parse_quantifier(const std::string &pattern, size_t *i, size_t *min, size_t *max) {
+    size_t pos = *i;
+    *min = *max = 1;
+
+    if (pos >= pattern.length()) {
+        return true;
+    }
+
+    switch (pattern[pos]) {
+        case '*':
+            *min = 0;
+            *max = kUnlimited;
+            pos++;
+            break;
+
+        case '+':
+            *max = kUnlimited;
+            pos++;
+            break;
+
+        case '?':
+            *min = 0;
+            pos++;
+            break;
+
+        case '{': {
+            size_t end = pattern.find('}', pos);
+            if (end == std::string::npos) {
+                return false;
+            }
+            auto bounds = pattern.substr(pos + 1, end - pos - 1);
+            auto comma = bounds.find(',');
+            auto lower = bounds.substr(0, comma);
+            if (lower.empty() || lower.length() > 5 || lower.find_first_not_of("0123456789") != std::string::npos) {
+                return false;
+            }
+            *min = *max = strtoul(lower.c_str(), NULL, 10);
+            if (comma != std::string::npos) {
+                auto upper = bounds.substr(comma + 1);
+                if (upper.empty()) {
+                    *max = kUnlimited;
+                }
+                else {
+                    if (upper.length() > 5 || upper.find_first_not_of("0123456789") != std::string::npos) {
+                        return false;
+                    }
+                    *max = strtoul(upper.c_str(), NULL, 10);
+                    if (*max < *min) {
+                        return false;
+                    }
+                }
+            }
+            pos = end + 1;
+            break;
+        }
+
+        default:
+            return true;
+    }
+
+    // lazy and possessive quantifiers
+    if (pos < pattern.length() && (pattern[pos] == '?' || pattern[pos] == '+')) {
+        return false;
+    }
+
+    *i = pos;
+    return true;
+}
+}
+
+
+void Regex::init_simple(const std::string &pattern) {
+    if (!parse_simple(pattern)) {
+        simple_ = SIMPLE_NONE;
+        literal_.clear();
+        atoms_.clear();
+    }
+}
+
+
+bool Regex::search(const char *subject, size_t length) const {
+    switch (simple_) {
+        case SIMPLE_NONE:
+            break;
+
+        case SIMPLE_LITERAL:
+            return std::search(subject, subject + length, literal_.begin(), literal_.end()) != subject + length || literal_.empty();
+
+        case SIMPLE_SUFFIX:
+            // $ also matches before a final newline
+            if (length > 0 && subject[length - 1] == '\n' && length - 1 >= literal_.length() && memcmp(subject + length - 1 - literal_.length(), literal_.data(), literal_.length()) == 0) {
+                return true;
+            }
+            return length >= literal_.length() && memcmp(subject + length - literal_.length(), literal_.data(), literal_.length()) == 0;
+
+        case SIMPLE_SEQUENCE: {
+            auto bytes = reinterpret_cast<const unsigned char *>(subject);
+            if (match_sequence(bytes, length)) {
+                return true;
+            }
+            return anchored_end_ && length > 0 && subject[length - 1] == '\n' && match_sequence(bytes, length - 1);
+        }
+    }
+
+    return search_library(subject, length);
+}
+
+
+bool Regex::match_sequence(const unsigned char *subject, size_t length) const {
+    size_t pos = 0;
+
+    for (const auto &atom : atoms_) {
+        size_t count = 0;
+        while (count < atom.max && pos < length && atom.chars[subject[pos]]) {
+            pos++;
+            count++;
+        }
+        if (count < atom.min) {
+            return false;
+        }
+    }
+
+    return !anchored_end_ || pos == length;
+}
+
+
+bool Regex::parse_simple(const std::string &pattern) {
+    size_t i = 0;
+    bool anchored_start = false;
+
+    if (!pattern.empty() && pattern[0] == '^') {
+        anchored_start = true;
+        i++;
+    }
+
+    while (i < pattern.length()) {
+        auto c = static_cast<unsigned char>(pattern[i]);
+
+        if (c == '$' && i == pattern.length() - 1) {
+            anchored_end_ = true;
+            break;
+        }
+
+        Atom atom;
+        memset(atom.chars, 0, sizeof(atom.chars));
+
+        if (c >= 0x80) {
+            return false;
+        }
+        else if (c == '[') {
+            i++;
+            if (!parse_class(pattern, &i, atom.chars)) {
+                return false;
+            }
+        }
+        else if (c == '\\') {
+            if (i + 1 >= pattern.length() || !add_escape(atom.chars, pattern[i + 1])) {
+                return false;
+            }
+            i += 2;
+        }
+        else if (c == '.') {
+            set_range(atom.chars, 0, 255, true);
+            atom.chars[static_cast<unsigned char>('\n')] = false;
+            i++;
+        }
+        else if (strchr("()|*+?{}^$]", c) != NULL) {
+            return false;
+        }
+        else {
+            atom.chars[c] = true;
+            i++;
+        }
+
+        if (!parse_quantifier(pattern, &i, &atom.min, &atom.max)) {
+            return false;
+        }
+        atoms_.push_back(atom);
+    }
+
+    if (!anchored_start) {
+        // Only literals can be found without trying every start position.
+        for (const auto &atom : atoms_) {
+            if (atom.min != 1 || atom.max != 1 || std::count(atom.chars, atom.chars + 256, true) != 1) {
+                return false;
+            }
+            literal_ += static_cast<char>(std::find(atom.chars, atom.chars + 256, true) - atom.chars);
+        }
+        atoms_.clear();
+        simple_ = anchored_end_ ? SIMPLE_SUFFIX : SIMPLE_LITERAL;
+        return true;
+    }
+
+    for (size_t j = 0; j < atoms_.size(); j++) {
+        if (atoms_[j].min == atoms_[j].max) {
+            continue;
+        }
+        for (size_t k = j + 1; k < atoms_.size(); k++) {
+            for (unsigned int c = 0; c < 256; c++) {
+                if (atoms_[j].chars[c] && atoms_[k].chars[c]) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    simple_ = SIMPLE_SEQUENCE;
+    return true;
+}
+
+}
@@ -0,0 +1,116 @@
+/*
+    Regex.h -- regular expressions
+    Copyright 2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef JSON_REGEX_H
+#define JSON_REGEX_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+/*
+  A compiled regular expression. The regex library is selected at build
+  time with REGEX_BACKEND (pcre2 or pcrecpp).
+
+  Matching does not modify the object, so one Regex can be used from
+  several threads at once. Match errors, including exceeding the match or
+  depth limit, count as no match.
+
+  Simple patterns (literals, anchored sequences of character classes) are
+  recognized when compiling, search() matches them without the regex
+  library.
+*/
+class Regex {
+public:
+    // A limit of 0 uses the library's default.
+    explicit Regex(const std::string &pattern, unsigned long match_limit = 0, unsigned long depth_limit = 0);
+    ~Regex();
+
+    // Error message if the pattern could not be compiled, empty otherwise.
+    const std::string &error() const { return error_; }
+
+    // Returns whether the pattern matches anywhere in |subject|.
+    bool search(const char *subject, size_t length) const;
+    bool search(const std::string &subject) const { return search(subject.data(), subject.length()); }
+
+    // Returns whether the pattern matches all of |subject|, storing the capture groups in |groups|.
+    // Groups that did not participate in the match are empty.
+    bool match(const std::string &subject, std::vector<std::string> *groups) const;
+
+    // Replaces all non-overlapping matches in |subject| with |replacement|, which must not contain backslashes.
+    void replace_all(const std::string &replacement, std::string *subject) const;
+
+private:
+    Regex(const Regex &);
+    Regex &operator=(const Regex &);
+
+    class Implementation;
+
+    enum Simple {
+        SIMPLE_NONE,     // use the regex library
+        SIMPLE_LITERAL,  // literal_ occurs in subject
+        SIMPLE_SUFFIX,   // subject ends with literal_
+        SIMPLE_SEQUENCE  // atoms_ match at start of subject, and at its end if anchored_end_
+    };
+
+    // Character class with repetition count.
+    struct Atom {
+        bool chars[256];
+        size_t min;
+        size_t max;
+    };
+
+    void init_simple(const std::string &pattern);
+    bool parse_simple(const std::string &pattern);
+    bool match_sequence(const unsigned char *subject, size_t length) const;
+
+    // Matches using the regex library, implemented by the backend.
+    bool search_library(const char *subject, size_t length) const;
+
+    std::unique_ptr<Implementation> implementation_;
+    std::string error_;
+
+    Simple simple_;
+    std::string literal_;
+    std::vector<Atom> atoms_;
+    bool anchored_end_;
+};
+
+}
+
+#endif // JSON_REGEX_H
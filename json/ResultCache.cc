@@ -0,0 +1,205 @@
+/*
+        ResultCache.cc -- cache of validation results
+        Copyright 2020 nfotex IT DL GmbH.
+
+        Redistribution and use in source and binary forms, with or without
+        modification, are permitted provided that the following conditions
+        are met:
+
+        1. Redistributions of source code must retain the above copyright
+             notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright
+             notice, this list of conditions and the following disclaimer in
+             the documentation and/or other materials provided with the
+             distribution.
+
+        3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+             its contributors may be used to endorse or promote products derived
+             from this software without specific prior written permission.
+
+        THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+        "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+        LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+        A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+        OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+        SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+        LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+        DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+        THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+        (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+        OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <json/ResultCache.h>
+
+#include <string.h>
+
+#include <algorithm>
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+ResultCache::ResultCache(size_t capacity) : capacity_(capacity) {
+}
+
+
+bool ResultCache::find(Json::UInt64 hash, const Json::Value &instance, bool *valid, std::vector<SchemaValidator::Error> *errors) {
+    Key key;
+    key.hash = hash;
+    key.text = false;
+    return find(key, NULL, &instance, valid, errors);
+}
+
+
+bool ResultCache::find(const std::string &text, bool *valid, std::vector<SchemaValidator::Error> *errors) {
+    Key key;
+    key.hash = hash_text(text);
+    key.text = true;
+    return find(key, &text, NULL, valid, errors);
+}
+
+
+bool ResultCache::find(const Key &key, const std::string *text, const Json::Value *instance, bool *valid, std::vector<SchemaValidator::Error> *errors) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = index_.find(key);
+    // Compared exactly: 1 and 1.0 hash alike, but may be reported differently in errors.
+    if (it == index_.end() || (text != NULL ? it->second->text != *text : it->second->instance != *instance)) {
+        statistics_.misses++;
+        return false;
+    }
+
+    entries_.splice(entries_.begin(), entries_, it->second);
+    *valid = it->second->valid;
+    if (errors != NULL) {
+        *errors = it->second->errors;
+    }
+    statistics_.hits++;
+    return true;
+}
+
+
+void ResultCache::insert(Json::UInt64 hash, const Json::Value &instance, bool valid, const std::vector<SchemaValidator::Error> &errors) {
+    if (value_size(instance, kMaxDocumentSize) > kMaxDocumentSize) {
+        return;
+    }
+
+    Entry entry;
+    entry.key.hash = hash;
+    entry.key.text = false;
+    entry.instance = instance;
+    entry.valid = valid;
+    entry.errors = errors;
+    insert(std::move(entry));
+}
+
+
+void ResultCache::insert(const std::string &text, bool valid, const std::vector<SchemaValidator::Error> &errors) {
+    if (text.length() > kMaxDocumentSize) {
+        return;
+    }
+
+    Entry entry;
+    entry.key.hash = hash_text(text);
+    entry.key.text = true;
+    entry.text = text;
+    entry.valid = valid;
+    entry.errors = errors;
+    insert(std::move(entry));
+}
+
+
+void ResultCache::insert(Entry &&entry) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = index_.find(entry.key);
+    if (it != index_.end()) {
+        // Another thread added it, or a different document with the same hash.
+        entries_.erase(it->second);
+        index_.erase(it);
+    }
+    else if (entries_.size() >= capacity_) {
+        index_.erase(entries_.back().key);
+        entries_.pop_back();
+        statistics_.evictions++;
+    }
+
+    entries_.push_front(std::move(entry));
+    index_[entries_.front().key] = entries_.begin();
+}
+
+
+SchemaValidator::CacheStatistics ResultCache::statistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto statistics = statistics_;
+    statistics.entries = entries_.size();
+    return statistics;
+}
+
+
+// static
+size_t ResultCache::value_size(const Json::Value &value, size_t limit) {
+    size_t size = sizeof(Json::Value);
+
+    switch (value.type()) {
+        case Json::stringValue: {
+            const char *begin;
+            const char *end;
+            value.getString(&begin, &end);
+            size += static_cast<size_t>(end - begin);
+            break;
+        }
+
+        case Json::arrayValue:
+        case Json::objectValue:
+            for (auto it = value.begin(); it != value.end() && size <= limit; ++it) {
+                if (value.isObject()) {
+                    const char *name_end;
+                    auto name = it.memberName(&name_end);
+                    size += static_cast<size_t>(name_end - name);
+                }
+                size += value_size(*it, limit - std::min(size, limit));
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return size;
+}
+
+
+// static
+Json::UInt64 ResultCache::hash_text(const std::string &text) {
+    // Eight bytes at a time, mixed as in MurmurHash64A.
+    const Json::UInt64 m = 0xc6a4a7935bd1e995ull;
+    Json::UInt64 hash = 0x9e3779b97f4a7c15ull ^ (text.length() * m);
+    const char *data = text.data();
+    size_t length = text.length();
+
+    for (; length >= 8; data += 8, length -= 8) {
+        Json::UInt64 word;
+        memcpy(&word, data, 8);
+        word *= m;
+        word ^= word >> 47;
+        word *= m;
+        hash = (hash ^ word) * m;
+    }
+    if (length > 0) {
+        Json::UInt64 word = 0;
+        memcpy(&word, data, length);
+        hash = (hash ^ word) * m;
+    }
+
+    hash ^= hash >> 47;
+    hash *= m;
+    hash ^= hash >> 47;
+    return hash;
+}
+
+}
@@ -0,0 +1,115 @@
+/*
+    ResultCache.h -- cache of validation results
+    Copyright 2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef JSON_RESULT_CACHE_H
+#define JSON_RESULT_CACHE_H
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <json/SchemaValidator.h>
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+/*
+  Validation results of recently seen documents, keyed by a hash of the
+  parsed document or of its text. The document itself is kept to rule out
+  hash collisions. When full, the least recently used entry is evicted.
+  Documents larger than kMaxDocumentSize are not cached, so memory use is
+  bounded by the capacity times that size.
+
+  All methods lock the cache, so it can be shared by validating threads.
+*/
+class ResultCache {
+public:
+    // Documents with more bytes of text, or approximately as much memory when parsed, are not cached.
+    static const size_t kMaxDocumentSize = 64 * 1024;
+
+    explicit ResultCache(size_t capacity);
+
+    // Returns whether a result for |instance| is cached, storing it in |valid| and, unless NULL, |errors|.
+    bool find(Json::UInt64 hash, const Json::Value &instance, bool *valid, std::vector<SchemaValidator::Error> *errors);
+    bool find(const std::string &text, bool *valid, std::vector<SchemaValidator::Error> *errors);
+
+    void insert(Json::UInt64 hash, const Json::Value &instance, bool valid, const std::vector<SchemaValidator::Error> &errors);
+    void insert(const std::string &text, bool valid, const std::vector<SchemaValidator::Error> &errors);
+
+    SchemaValidator::CacheStatistics statistics() const;
+
+private:
+    ResultCache(const ResultCache &);
+    ResultCache &operator=(const ResultCache &);
+
+    struct Key {
+        Json::UInt64 hash;
+        bool text; // hash of document text rather than parsed document
+
+        bool operator==(const Key &other) const { return hash == other.hash && text == other.text; }
+    };
+    struct KeyHash {
+        size_t operator()(const Key &key) const { return static_cast<size_t>(key.hash) ^ (key.text ? 1 : 0); }
+    };
+
+    struct Entry {
+        Key key;
+        std::string text;
+        Json::Value instance;
+        bool valid;
+        std::vector<SchemaValidator::Error> errors;
+    };
+    typedef std::list<Entry> Entries;
+
+    static Json::UInt64 hash_text(const std::string &text);
+    // Approximate memory used by |value|, counting at most up to |limit|.
+    static size_t value_size(const Json::Value &value, size_t limit);
+
+    bool find(const Key &key, const std::string *text, const Json::Value *instance, bool *valid, std::vector<SchemaValidator::Error> *errors);
+    void insert(Entry &&entry);
+
+    size_t capacity_;
+    mutable std::mutex mutex_;
+    // Most recently used first.
+    Entries entries_;
+    std::unordered_map<Key, Entries::iterator, KeyHash> index_;
+    SchemaValidator::CacheStatistics statistics_;
+};
+
+}
+
+#endif // JSON_RESULT_CACHE_H
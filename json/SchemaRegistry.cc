@@ -0,0 +1,303 @@
+/*
+    SchemaRegistry.cc -- compiled schema documents shared by validators
+    Copyright 2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <json/SchemaRegistry.h>
+
+#include <json/URI.h>
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+SchemaRegistry::SchemaRegistry(const SchemaValidator::Options &options) : options_(options), compiler_(new SchemaValidator(options)) {
+}
+
+
+SchemaRegistry::~SchemaRegistry() {
+}
+
+
+std::string SchemaRegistry::add(const std::string &schema_str, const std::string &uri) {
+    Json::Reader reader;
+    Json::Value schema;
+
+    if (!reader.parse(schema_str, schema)) {
+        SchemaValidator::Exception e(SchemaValidator::Exception::PARSING);
+        e.errors.push_back(SchemaValidator::Error("", reader.getFormattedErrorMessages()));
+        throw e;
+    }
+
+    return add(schema, uri);
+}
+
+
+std::string SchemaRegistry::add(const Json::Value &schema, const std::string &uri) {
+    std::vector<SchemaValidator::Error> errors;
+    if (!options_.trusted && !SchemaValidator::meta_validator().validate(schema, &errors)) {
+        SchemaValidator::Exception e(SchemaValidator::Exception::SCHEMA_VALIDATION);
+        e.errors = errors;
+        throw e;
+    }
+
+    URI base(uri);
+    if (base.has_fragment() && base.get_fragment().empty()) {
+        base.clear_fragment();
+    }
+    auto has_id = schema.isObject() && schema.isMember("$id");
+    if (!has_id && base.get_uri().empty()) {
+        SchemaValidator::Exception e(SchemaValidator::Exception::POINTER);
+        e.errors.push_back(SchemaValidator::Error("", "schema has neither $id nor uri"));
+        throw e;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    documents_.push_back(schema);
+    const Json::Value &document = documents_.back();
+    if (!has_id) {
+        compiler_->ids[base.get_uri()] = &document;
+    }
+    compiler_->collect_ids_refs(document, base, false);
+    pending_.push_back(Document(&document, base.get_uri()));
+
+    if (has_id) {
+        base = base.resolve(document["$id"].asString());
+        if (base.has_fragment() && base.get_fragment().empty()) {
+            base.clear_fragment();
+        }
+    }
+    return base.get_uri();
+}
+
+
+bool SchemaRegistry::contains(const std::string &uri) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    try {
+        return compiler_->find_schema(URI(uri)) != &compiler_->refs_root_;
+    }
+    catch (SchemaValidator::Exception &) {
+        return false;
+    }
+}
+
+
+size_t SchemaRegistry::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return documents_.size();
+}
+
+
+size_t SchemaRegistry::compiled_nodes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return compiler_->compiled_->nodes.size();
+}
+
+
+void SchemaRegistry::attach(const std::string &uri, SchemaValidator *validator) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    compile_pending();
+
+    auto target = compiler_->find_schema(URI(uri));
+    if (target == &compiler_->refs_root_) {
+        SchemaValidator::Exception e(SchemaValidator::Exception::POINTER);
+        e.errors.push_back(SchemaValidator::Error("", "no schema for uri '" + uri + "'"));
+        throw e;
+    }
+    if (!failed_.empty()) {
+        URI document_uri(uri);
+        document_uri.clear_fragment();
+        auto document = compiler_->ids.find(document_uri.get_uri());
+        if (document != compiler_->ids.end()) {
+            auto failed = failed_.find(document->second);
+            if (failed != failed_.end()) {
+                std::rethrow_exception(failed->second);
+            }
+        }
+    }
+
+    SchemaValidator::NodeIndex root;
+    auto it = compiled_.find(target);
+    if (it != compiled_.end()) {
+        root = it->second;
+    }
+    else {
+        std::vector<const Json::Value *> schemata;
+        schemata.push_back(target);
+        compile(schemata);
+        root = compiled_[target];
+    }
+
+    validator->compiled_ = compiler_->compiled_;
+    validator->root_ = root;
+    if (validator->engine_ == SchemaValidator::ENGINE_BYTECODE) {
+        if (!program_) {
+            compiler_->lower();
+            program_ = compiler_->program_;
+        }
+        validator->program_ = program_;
+    }
+}
+
+
+// Resolves the $refs of documents added since the last call and compiles them with their definitions.
+// Documents that fail stay pending with their error, so the others can be used.
+void SchemaRegistry::compile_pending() const {
+    if (pending_.size() == failed_.size()) {
+        // Nothing was added since the last attempt.
+        return;
+    }
+
+    try {
+        compile_documents(pending_);
+        pending_.clear();
+        failed_.clear();
+        return;
+    }
+    catch (SchemaValidator::Exception &) {
+        if (pending_.size() == 1) {
+            failed_.clear();
+            failed_.insert(std::make_pair(pending_.front().first, std::current_exception()));
+            return;
+        }
+    }
+
+    // One at a time, to find the documents at fault.
+    std::vector<Document> failed;
+    failed_.clear();
+    for (const auto &document : pending_) {
+        try {
+            compile_documents(std::vector<Document>(1, document));
+        }
+        catch (SchemaValidator::Exception &) {
+            failed.push_back(document);
+            failed_.insert(std::make_pair(document.first, std::current_exception()));
+        }
+    }
+    pending_.swap(failed);
+}
+
+
+// Resolves the $refs of |documents| and compiles them. On error, the compiler is left as before.
+void SchemaRegistry::compile_documents(const std::vector<Document> &documents) const {
+    auto saved_refs = compiler_->refs;
+    auto saved_ref_bases = compiler_->ref_bases;
+    auto saved_ids = compiler_->ids;
+    auto saved_sub_schemata = compiler_->sub_schemata;
+    auto saved_remote_documents = compiler_->remote_documents;
+
+    try {
+        std::vector<const Json::Value *> schemata;
+        for (const auto &document : documents) {
+            compiler_->collect_ids_refs(*document.first, URI(document.second), true);
+            collect_schemata(*document.first, &schemata);
+        }
+        compiler_->resolve_refs(!options_.trusted);
+        // Targets of $refs may be anywhere in a document.
+        for (const auto &ref : compiler_->refs) {
+            if (ref.second != NULL) {
+                schemata.push_back(ref.second);
+            }
+        }
+
+        // Already compiled schemata are skipped by compile().
+        compile(schemata);
+    }
+    catch (...) {
+        compiler_->refs.swap(saved_refs);
+        compiler_->ref_bases.swap(saved_ref_bases);
+        compiler_->ids.swap(saved_ids);
+        compiler_->sub_schemata.swap(saved_sub_schemata);
+        compiler_->remote_documents.swap(saved_remote_documents);
+        throw;
+    }
+}
+
+
+// Compiles |schemata| into a copy of the compiled documents, validators keep using the old ones.
+void SchemaRegistry::compile(const std::vector<const Json::Value *> &schemata) const {
+    auto saved = compiler_->compiled_;
+    auto saved_compiled = compiled_;
+
+    compiler_->compiled_ = std::make_shared<SchemaValidator::CompiledSchema>(*saved);
+    try {
+        for (auto schema : schemata) {
+            compiler_->compile_root(*schema, &compiled_);
+        }
+    }
+    catch (...) {
+        compiler_->compiled_ = saved;
+        compiled_ = saved_compiled;
+        throw;
+    }
+    program_.reset();
+}
+
+
+
+// static
+void SchemaRegistry::collect_schemata(const Json::Value &schema, std::vector<const Json::Value *> *schemata) {
+    schemata->push_back(&schema);
+    if (!schema.isObject()) {
+        return;
+    }
+
+    for (const auto &key : SchemaValidator::schema_member_names) {
+        if (schema.isMember(key) && (schema[key].isObject() || schema[key].isBool())) {
+            collect_schemata(schema[key], schemata);
+        }
+    }
+    for (const auto &key : SchemaValidator::schema_array_member_names) {
+        if (schema.isMember(key) && schema[key].isArray()) {
+            for (const auto &child : schema[key]) {
+                collect_schemata(child, schemata);
+            }
+        }
+    }
+    for (const auto &key : SchemaValidator::schema_object_member_names) {
+        if (schema.isMember(key) && schema[key].isObject()) {
+            for (const auto &child : schema[key]) {
+                // Property dependencies are lists of names.
+                if (child.isObject() || child.isBool()) {
+                    collect_schemata(child, schemata);
+                }
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,120 @@
+/*
+    SchemaRegistry.h -- compiled schema documents shared by validators
+    Copyright 2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef JSON_SCHEMA_REGISTRY_H
+#define JSON_SCHEMA_REGISTRY_H
+
+#include <exception>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <json/json.h>
+#include <json/SchemaValidator.h>
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+/*
+  Schema documents keyed by their $id, compiled once and shared by all
+  validators created from the registry. $refs between documents are
+  resolved, so common definitions can be kept in a document of their own.
+
+  Add all documents before creating validators: the compiled documents
+  are immutable and reference counted, compiling another document copies
+  them. All sub-schemata and $ref targets of a document are compiled with
+  it, so validators for fragments of it share the compiled documents;
+  only a fragment outside of them (e.g. under an unknown keyword) costs
+  another copy. Validators may outlive the registry.
+
+  All methods are thread safe.
+*/
+class SchemaRegistry {
+public:
+    // The regular expression limits of |options| are used when compiling.
+    explicit SchemaRegistry(const SchemaValidator::Options &options = SchemaValidator::Options());
+    ~SchemaRegistry();
+
+    // Adds a schema document, identified by its $id resolved against |uri|, or by |uri| if it has none.
+    // Returns that URI. Throws SchemaValidator::Exception if it is not a valid schema.
+    std::string add(const Json::Value &schema, const std::string &uri = "");
+    std::string add(const std::string &schema_str, const std::string &uri = "");
+
+    // Returns whether |uri| refers to a schema in one of the added documents.
+    bool contains(const std::string &uri) const;
+
+    // Number of documents added.
+    size_t size() const;
+    // Number of compiled schema nodes shared by the validators.
+    size_t compiled_nodes() const;
+
+private:
+    friend class SchemaValidator;
+
+    SchemaRegistry(const SchemaRegistry &);
+    SchemaRegistry &operator=(const SchemaRegistry &);
+
+    // A document and the URI its $id is resolved against.
+    typedef std::pair<const Json::Value *, std::string> Document;
+
+    // Sets up |validator| to validate against the schema |uri| refers to.
+    void attach(const std::string &uri, SchemaValidator *validator) const;
+    void compile_pending() const;
+    void compile_documents(const std::vector<Document> &documents) const;
+    void compile(const std::vector<const Json::Value *> &schemata) const;
+    // Appends |schema| and its sub-schemata, including definitions, to |schemata|.
+    static void collect_schemata(const Json::Value &schema, std::vector<const Json::Value *> *schemata);
+
+    mutable std::mutex mutex_;
+    SchemaValidator::Options options_;
+    // Added documents, never moved.
+    std::list<Json::Value> documents_;
+    // Documents whose $refs are not resolved and that are not compiled yet.
+    mutable std::vector<Document> pending_;
+    // Error of each pending document that failed to compile, retried when documents are added.
+    mutable std::unordered_map<const Json::Value *, std::exception_ptr> failed_;
+    // Holds ids, resolved refs and the compiled documents.
+    std::unique_ptr<SchemaValidator> compiler_;
+    mutable std::unordered_map<const Json::Value *, SchemaValidator::NodeIndex> compiled_;
+    // Bytecode for compiler_->compiled_, created when first needed.
+    mutable std::shared_ptr<SchemaValidator::Program> program_;
+};
+
+}
+
+#endif // JSON_SCHEMA_REGISTRY_H
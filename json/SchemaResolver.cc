@@ -0,0 +1,192 @@
+/*
+    SchemaResolver.cc -- load schema documents referenced by $ref
+    Copyright 2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <json/SchemaResolver.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <fstream>
+#include <streambuf>
+
+#include <json/SchemaValidator.h>
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+SchemaResolver::SchemaResolver() {
+}
+
+
+SchemaResolver::~SchemaResolver() {
+}
+
+
+void SchemaResolver::add(const std::string &uri, const Json::Value &document) {
+    check(uri, document);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    Document &entry = documents_[uri];
+    entry.value = std::make_shared<const Json::Value>(document);
+    entry.checked = true;
+}
+
+
+void SchemaResolver::map(const std::string &prefix, const std::string &directory) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    directories_.push_back(std::make_pair(prefix, directory));
+}
+
+
+std::shared_ptr<const Json::Value> SchemaResolver::resolve(const std::string &uri, bool check_schema) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = documents_.find(uri);
+    if (it == documents_.end()) {
+        Document document;
+        Json::Value value;
+        if (load(uri, &value)) {
+            document.value = std::make_shared<const Json::Value>(std::move(value));
+        }
+        it = documents_.insert(std::make_pair(uri, document)).first;
+    }
+
+    Document &document = it->second;
+    if (check_schema && document.value && !document.checked) {
+        check(uri, *document.value);
+        document.checked = true;
+    }
+    return document.value;
+}
+
+
+void SchemaResolver::check(const std::string &uri, const Json::Value &document) {
+    std::vector<SchemaValidator::Error> errors;
+    if (!SchemaValidator::meta_validator().validate(document, &errors)) {
+        SchemaValidator::Exception e(SchemaValidator::Exception::SCHEMA_VALIDATION);
+        for (auto &error : errors) {
+            e.errors.push_back(SchemaValidator::Error(uri + "#" + error.path, error.message));
+        }
+        throw e;
+    }
+}
+
+
+bool SchemaResolver::load(const std::string &uri, Json::Value *document) {
+    // Dot segments could leave the mapped directory.
+    if (has_dot_segment(uri)) {
+        return false;
+    }
+
+    for (const auto &directory : directories_) {
+        if (uri.compare(0, directory.first.length(), directory.first) != 0) {
+            continue;
+        }
+
+        auto filename = directory.second + "/" + uri.substr(directory.first.length());
+        if (!is_inside(filename, directory.second)) {
+            continue;
+        }
+        std::ifstream file(filename.c_str());
+        if (!file.is_open()) {
+            continue;
+        }
+        std::string str((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        Json::Reader reader;
+        if (!reader.parse(str, *document)) {
+            SchemaValidator::Exception e(SchemaValidator::Exception::PARSING);
+            e.errors.push_back(SchemaValidator::Error(uri, reader.getFormattedErrorMessages()));
+            throw e;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+
+
+// static
+bool SchemaResolver::has_dot_segment(const std::string &uri) {
+    size_t start = 0;
+    while (start <= uri.length()) {
+        auto end = uri.find_first_of("/?#", start);
+        if (end == std::string::npos) {
+            end = uri.length();
+        }
+        // Also percent encoded dots, which some resolvers decode.
+        std::string segment;
+        for (auto i = start; i < end; i++) {
+            if (uri[i] == '%' && i + 2 < end && uri[i + 1] == '2' && (uri[i + 2] == 'e' || uri[i + 2] == 'E')) {
+                segment += '.';
+                i += 2;
+            }
+            else {
+                segment += uri[i];
+            }
+        }
+        if (segment == "." || segment == "..") {
+            return true;
+        }
+        if (end == uri.length() || uri[end] != '/') {
+            break;
+        }
+        start = end + 1;
+    }
+    return false;
+}
+
+
+// static
+bool SchemaResolver::is_inside(const std::string &filename, const std::string &directory) {
+    char *file_path = realpath(filename.c_str(), NULL);
+    char *directory_path = realpath(directory.c_str(), NULL);
+    auto inside = false;
+    if (file_path != NULL && directory_path != NULL) {
+        std::string prefix = directory_path;
+        if (prefix.empty() || prefix.back() != '/') {
+            prefix += '/';
+        }
+        inside = strncmp(file_path, prefix.c_str(), prefix.length()) == 0;
+    }
+    free(file_path);
+    free(directory_path);
+    return inside;
+}
+
+}
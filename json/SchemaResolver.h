@@ -0,0 +1,112 @@
+/*
+    SchemaResolver.h -- load schema documents referenced by $ref
+    Copyright 2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef JSON_SCHEMA_RESOLVER_H
+#define JSON_SCHEMA_RESOLVER_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <json/json.h>
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+/*
+  Provides the documents of $refs to URIs that are not an $id of the
+  schema, without network access: from documents added to the resolver
+  or from files in local directories mapped to URI prefixes. Subclasses
+  can override load() to get documents elsewhere.
+
+  Each document is loaded and checked against the meta-schema once, then
+  shared by all validators using the resolver. Documents resolved for
+  trusted validators are not checked until an untrusted one uses them.
+  All methods are thread safe.
+*/
+class SchemaResolver {
+public:
+    SchemaResolver();
+    virtual ~SchemaResolver();
+
+    // Adds |document| as the schema for |uri|.
+    void add(const std::string &uri, const Json::Value &document);
+    // Loads documents for URIs starting with |prefix| from |directory|, e.g.
+    // "http://example.com/schemas/" and "/usr/share/schemas".
+    void map(const std::string &prefix, const std::string &directory);
+
+    // Returns the document for |uri|, which has no fragment, or NULL if there is none.
+    // Throws SchemaValidator::Exception if the document can't be parsed or, with |check_schema|,
+    // is not a valid schema.
+    std::shared_ptr<const Json::Value> resolve(const std::string &uri, bool check_schema = true);
+
+protected:
+    // Loads the document for |uri| into |document|. Returns false if there is none.
+    // The default implementation reads from the mapped directories, refusing URIs with "." or
+    // ".." segments and files outside of the directory.
+    virtual bool load(const std::string &uri, Json::Value *document);
+
+private:
+    SchemaResolver(const SchemaResolver &);
+    SchemaResolver &operator=(const SchemaResolver &);
+
+    // Throws SchemaValidator::Exception if |document| is not a valid schema.
+    static void check(const std::string &uri, const Json::Value &document);
+    // Whether the path of |uri| has a "." or ".." segment, also percent encoded.
+    static bool has_dot_segment(const std::string &uri);
+    // Whether |filename| exists and, with symbolic links resolved, is below |directory|.
+    static bool is_inside(const std::string &filename, const std::string &directory);
+
+    std::mutex mutex_;
+    struct Document {
+        Document() : checked(false) { }
+
+        // NULL for URIs without document.
+        std::shared_ptr<const Json::Value> value;
+        // Whether value was checked against the meta-schema.
+        bool checked;
+    };
+
+    // Loaded documents.
+    std::unordered_map<std::string, Document> documents_;
+    std::vector<std::pair<std::string, std::string> > directories_;
+};
+
+}
+
+#endif // JSON_SCHEMA_RESOLVER_H
@@ -38,15 +38,20 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 
+#include <algorithm>
 #include <cfloat>
+#include <chrono>
 #include <cmath>
 #include <exception>
 #include <limits>
 
-#include <pcrecpp.h>
-
 #include <json/Pointer.h>
+#include <json/Regex.h>
+#include <json/ResultCache.h>
+#include <json/SchemaRegistry.h>
+#include <json/SchemaResolver.h>
 
 #undef JSON_DEBUG_REF
 
@@ -55,8 +60,6 @@ namespace Json {
 } // fix auto indent
 #endif
 
-SchemaValidator *SchemaValidator::meta_validator = NULL;
-Json::Value SchemaValidator::meta_schema_root;
 
 const std::vector<std::string> SchemaValidator::schema_member_names = {
   "additionalItems",
@@ -119,11 +122,15 @@ static void ReplaceFirstSubstringAfterOffset(std::string* str,
   }
 }
 
+static double elapsed_ns(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
 
-std::string SchemaValidator::IntToString(int i) {
+std::string SchemaValidator::IntToString(Json::Int64 i) {
   char buf[1024];
 
-  sprintf(buf, "%d", i);
+  sprintf(buf, "%" PRId64, i);
   return std::string(buf);
 }
 
@@ -178,7 +185,9 @@ const char SchemaValidator::kArrayMaxItems[] =
 const char SchemaValidator::kArrayItemRequired[] =
     "Item is required.";
 const char SchemaValidator::kArrayItemsNotUnique[] =
-    "Items not unique.";
+    "Items * and * are not unique.";
+const char SchemaValidator::kUniqueItemsSpillFailed[] =
+    "Can't check uniqueItems, temporary file failed: *.";
 const char SchemaValidator::kNoAdditionalItems[] =
     "Additional items not allowed.";
 const char SchemaValidator::kStringMinLength[] =
@@ -219,33 +228,7 @@ const char SchemaValidator::kConst[] =
 
 // static
 std::string SchemaValidator::GetSchemaType(const Json::Value &value) {
-  switch (value.type()) {
-    case Json::nullValue:
-      return "null";
-    case Json::booleanValue:
-      return "boolean";
-    case Json::intValue:
-    case Json::uintValue:
-      return "integer";
-    case Json::realValue: {
-      double double_value = value.asDouble();
-      if (std::abs(double_value) <= std::pow(2.0, DBL_MANT_DIG) &&
-          double_value == floor(double_value)) {
-        return "integer";
-      } else {
-        return "number";
-      }
-    }
-    case Json::stringValue:
-      return "string";
-    case Json::objectValue:
-      return "object";
-    case Json::arrayValue:
-      return "array";
-    default:
-      //CHECK(false); //<< "Unexpected value type: " << value->GetType();
-      return "";
-  }
+  return type_bit_name(type_bit(value));
 }
 
 // static
@@ -269,7 +252,9 @@ std::string SchemaValidator::FormatErrorMessage(const std::string& format,
 SchemaValidator::SchemaValidator(std::string schema_string, const Options &options) {
   Json::Reader reader;
 
+  auto start = std::chrono::steady_clock::now();
   bool success = reader.parse (schema_string, refs_root_);
+  construction_timing_.parse_ns = elapsed_ns(start);
   if (!success) {
     SchemaValidator::Exception e(Exception::PARSING);
     // TODO: properly formatted error messages once we have the interface
@@ -282,22 +267,81 @@ SchemaValidator::SchemaValidator(std::string schema_string, const Options &optio
 
 
 SchemaValidator *SchemaValidator::create_meta_validator() {
-  if (meta_schema_root.isNull()) {
-    Json::Reader reader;
-    
-    if (!reader.parse(meta_schema, meta_schema_root)) {
-      throw Exception(Exception::INTERNAL);
-    }
+  try {
+    return new SchemaValidator(meta_schema_compiled, meta_schema_compiled_size, Options());
   }
-  
-  return new SchemaValidator(meta_schema_root, Options(), false);
+  catch (Exception &) {
+    // Tables from an incompatible version, run update_meta_schema.
+  }
+  return new SchemaValidator(meta_schema_root(), Options(), false);
+}
+
+
+// static
+const Json::Value &SchemaValidator::meta_schema_root() {
+  // Initialization of local statics is thread safe.
+  static const Json::Value root = parse_meta_schema();
+  return root;
+}
+
+
+// static
+Json::Value SchemaValidator::parse_meta_schema() {
+  Json::Reader reader;
+  Json::Value root;
+
+  if (!reader.parse(meta_schema, root)) {
+    throw Exception(Exception::INTERNAL);
+  }
+  return root;
+}
+
+
+// static
+const SchemaValidator &SchemaValidator::meta_validator() {
+  // Created once, then only used through the const validate(), so it can be shared by threads.
+  static const std::unique_ptr<const SchemaValidator> validator(create_meta_validator());
+  return *validator;
 }
 
 SchemaValidator::SchemaValidator(Json::Value schema, const Options &options, bool validate_schema) : refs_root_(schema) {
   init(options, validate_schema);
 }
 
+SchemaValidator::SchemaValidator(const Json::UInt64 *words, size_t count, const Options &options) : schema_root_(&refs_root_) {
+  set_options(options);
+  load(words, count);
+}
+
+SchemaValidator::SchemaValidator(const Options &options) : schema_root_(&refs_root_), compiled_(std::make_shared<CompiledSchema>()), root_(kNoNode) {
+  set_options(options);
+}
+
+SchemaValidator::SchemaValidator(const SchemaRegistry &registry, const std::string &uri, const Options &options) : schema_root_(&refs_root_) {
+  set_options(options);
+  registry.attach(uri, this);
+}
+
+void SchemaValidator::set_options(const Options &options) {
+  engine_ = options.engine;
+  regex_match_limit = options.regex_match_limit;
+  regex_depth_limit = options.regex_depth_limit;
+  unique_items_memory_limit_ = options.unique_items_memory_limit;
+  temporary_directory_ = options.temporary_directory;
+  max_errors_ = options.max_errors;
+  memoize_ = options.memoize;
+  if (options.result_cache_size > 0) {
+    result_cache_ = std::make_shared<ResultCache>(options.result_cache_size);
+  }
+  resolver_ = options.resolver;
+  trusted_ = options.trusted;
+}
+
 void SchemaValidator::init(const Options &options, bool validate_schema) {
+  set_options(options);
+  validate_schema = validate_schema && !options.trusted;
+  compiled_ = std::make_shared<CompiledSchema>();
+
   if (options.schema_pointer.length() > 0) {
     try {
       Json::Pointer pointer(options.schema_pointer);
@@ -312,19 +356,14 @@ void SchemaValidator::init(const Options &options, bool validate_schema) {
     schema_root_ = &refs_root_;
   }
   
+  std::vector<Error> schema_errors;
   if (validate_schema) {
-    if (meta_validator == NULL) {
-      meta_validator = create_meta_validator();
-    }
-    
-    if (!meta_validator->validate(*schema_root_)) {
+    auto start = std::chrono::steady_clock::now();
+    auto valid = meta_validator().validate(*schema_root_, &schema_errors);
+    construction_timing_.meta_validation_ns += elapsed_ns(start);
+    if (!valid) {
       SchemaValidator::Exception e(Exception::SCHEMA_VALIDATION);
-      if (options.schema_pointer.length() > 0) {
-        e.errors = meta_validator->errors(options.schema_pointer);
-      }
-      else {
-        e.errors = meta_validator->errors();
-      }
+      e.errors = prefix_errors(options.schema_pointer, schema_errors);
       throw e;
     }
   }
@@ -340,29 +379,63 @@ void SchemaValidator::init(const Options &options, bool validate_schema) {
     for (auto key : definitions.getMemberNames()) {
       const Json::Value &schema = definitions[key];
       if (validate_schema) {
-        if (!meta_validator->validate(schema)) {
+        auto start = std::chrono::steady_clock::now();
+        auto valid = meta_validator().validate(schema, &schema_errors);
+        construction_timing_.meta_validation_ns += elapsed_ns(start);
+        if (!valid) {
           SchemaValidator::Exception e(Exception::SCHEMA_VALIDATION);
-          e.errors = meta_validator->errors("/definitions/" + key);
+          e.errors = prefix_errors("/definitions/" + key, schema_errors);
           throw e;
         }
       }
+      auto start = std::chrono::steady_clock::now();
       collect_ids_refs(schema, URI(), false);
       collect_ids_refs(schema, URI(), true);
+      construction_timing_.collection_ns += elapsed_ns(start);
     }
   }
 
+  auto start = std::chrono::steady_clock::now();
   collect_ids_refs(*schema_root_, URI(), false);
   collect_ids_refs(*schema_root_, URI(), true);
+  construction_timing_.collection_ns += elapsed_ns(start);
+
+  resolve_refs(validate_schema);
+
+  start = std::chrono::steady_clock::now();
+  compiled_ = std::make_shared<CompiledSchema>();
+  std::unordered_map<const Json::Value *, NodeIndex> compiled;
+  root_ = compile_root(*schema_root_, &compiled);
+  compiled_->root = root_;
+
+  if (engine_ == ENGINE_BYTECODE) {
+    lower();
+  }
+  construction_timing_.compile_ns = elapsed_ns(start);
+
+  ids.clear();
+  sub_schemata.clear();
+  refs.clear();
+  ref_bases.clear();
+  remote_documents.clear();
+}
+
 
+// Collects the ids and refs of sub-schemata only reachable by $ref and resolves chains of $refs.
+void SchemaValidator::resolve_refs(bool validate_schema) {
+  std::vector<Error> schema_errors;
   std::unordered_set<const Json::Value *> new_sub_schemata;
   do {
     new_sub_schemata.clear();
     for (auto pair : refs) {
       if (sub_schemata.find(pair.second) == sub_schemata.end()) {
         if (validate_schema) {
-          if (!meta_validator->validate(*pair.second)) {
+          auto start = std::chrono::steady_clock::now();
+          auto valid = meta_validator().validate(*pair.second, &schema_errors);
+          construction_timing_.meta_validation_ns += elapsed_ns(start);
+          if (!valid) {
             SchemaValidator::Exception e(Exception::SCHEMA_VALIDATION);
-            e.errors = meta_validator->errors(); // TODO: don't know path
+            e.errors = schema_errors; // TODO: don't know path
             throw e;
           }
         }
@@ -370,13 +443,18 @@ void SchemaValidator::init(const Options &options, bool validate_schema) {
       }
     }
 
+    auto start = std::chrono::steady_clock::now();
     for (auto node : new_sub_schemata) {
-      // TODO: don't know correct URI.
-      collect_ids_refs(*node, URI(), false);
-      collect_ids_refs(*node, URI(), true);
+      // $ids between the document and the target are not taken into account.
+      auto it = ref_bases.find(node);
+      auto base_uri = it != ref_bases.end() ? it->second : URI();
+      collect_ids_refs(*node, base_uri, false);
+      collect_ids_refs(*node, base_uri, true);
     }
+    construction_timing_.collection_ns += elapsed_ns(start);
   } while (!new_sub_schemata.empty());
 
+  auto start = std::chrono::steady_clock::now();
   for (auto pair : refs) {
     const Json::Value *node = pair.second;
     if (node->isObject() && node->isMember("$ref")) {
@@ -404,632 +482,1660 @@ void SchemaValidator::init(const Options &options, bool validate_schema) {
     }
   }
 
-  ids.clear();
-  sub_schemata.clear();
+  construction_timing_.resolution_ns += elapsed_ns(start);
 }
 
 
-void SchemaValidator::collect_ids_refs(const Json::Value &node, URI base_uri, bool process_refs) {
-  if (!process_refs) {
-    sub_schemata.insert(&node);
+// Compiles |schema| into compiled_, adding to what is already there. Returns the index of its node.
+SchemaValidator::NodeIndex SchemaValidator::compile_root(const Json::Value &schema, std::unordered_map<const Json::Value *, NodeIndex> *compiled) {
+  auto first_node = compiled_->nodes.size();
+  auto root = compile(schema, compiled);
+
+  // Existing nodes don't refer to new ones, so only the new nodes' branches are computed.
+  compiled_->branches.resize(compiled_->node_lists.size(), Branch());
+  for (auto i = first_node; i < compiled_->nodes.size(); i++) {
+    auto &node = compiled_->nodes[i];
+    if (node.has(Node::ANY_OF) && compile_branches(node.any_of, &node.any_of_discriminator)) {
+      node.keywords |= Node::ANY_OF_DISCRIMINATOR;
+    }
+    if (node.has(Node::ONE_OF) && compile_branches(node.one_of, &node.one_of_discriminator)) {
+      node.keywords |= Node::ONE_OF_DISCRIMINATOR;
+    }
   }
 
-  if (!node.isObject()) {
-    return;
+  return root;
+}
+
+
+SchemaValidator::Node::Node()
+    : keywords(0), ref(kNoNode), types(0),
+      not_schema(kNoNode), if_schema(kNoNode), then_schema(kNoNode), else_schema(kNoNode),
+      const_value(0), default_value(0),
+      min_properties(0), max_properties(0), additional_properties(kNoNode), property_names(kNoNode),
+      min_items(0), max_items(0), items(kNoNode), additional_items(kNoNode), contains(kNoNode),
+      min_length(0), max_length(0), pattern_regex(0),
+      minimum(0), exclusive_minimum(0), maximum(0), exclusive_maximum(0), multiple_of(0) {
+}
+
+
+// Largest magnitude up to which all integers are exactly representable as double.
+static const double kMaxExactInteger = static_cast<double>(1ull << DBL_MANT_DIG);
+
+// Enums with fewer values are searched linearly.
+static const Json::UInt kEnumHashMinimum = 8;
+
+// Arrays with fewer items are checked for uniqueness pairwise.
+static const Json::ArrayIndex kUniqueItemsHashMinimum = 8;
+
+
+static int compare_names(const char *a, size_t a_length, const char *b, size_t b_length) {
+  auto result = memcmp(a, b, std::min(a_length, b_length));
+  if (result != 0) {
+    return result;
+  }
+  if (a_length != b_length) {
+    return a_length < b_length ? -1 : 1;
+  }
+  return 0;
+}
+
+
+SchemaValidator::NodeIndex SchemaValidator::compile(const Json::Value &schema, std::unordered_map<const Json::Value *, NodeIndex> *compiled) {
+  auto it = compiled->find(&schema);
+  if (it != compiled->end()) {
+    return it->second;
   }
-  if (node.isMember("$ref")) {
-    if (process_refs) {
-      auto ref_uri = base_uri.resolve(node["$ref"].asString());
-      auto ref_string = ref_uri.get_uri();
-      std::string fragment;
 
-      if (ref_uri.has_fragment()) {
-        fragment = ref_uri.get_fragment();
+  // Reserve the slot first, so recursive references find it.
+  NodeIndex index = static_cast<NodeIndex>(compiled_->nodes.size());
+  compiled_->nodes.push_back(Node());
+  (*compiled)[&schema] = index;
+
+  Node node;
+
+  if (schema.isBool()) {
+    if (!schema.asBool()) {
+      node.keywords |= Node::FALSE_SCHEMA;
+    }
+  }
+  else if (schema.isObject()) {
+    if (schema.isMember("$ref")) {
+      // $ref overrides all other keywords.
+      node.keywords |= Node::REF;
+      node.ref_name = add_string(schema["$ref"].asString());
+      auto target = resolve_ref(&schema);
+      if (target != NULL) {
+        node.ref = compile(*target, compiled);
       }
+      compiled_->nodes[index] = node;
+      return index;
+    }
 
-      if (fragment.empty()) {
-        ref_uri.clear_fragment();
+    if (schema.isMember("type")) {
+      const Json::Value &type = schema["type"];
+      node.keywords |= Node::TYPE;
+      if (type.isArray()) {
+        node.keywords |= Node::TYPE_CHOICES;
+        for (const Json::Value &choice : type) {
+          if (choice.isString()) {
+            node.types |= type_mask(choice.asString());
+          }
+        }
       }
       else {
-        if (fragment[0] == '/') {
-          ref_uri.clear_fragment();
-        }
-        else {
-          fragment = "";
-        }
+        node.types = type_mask(type.asString());
+        node.type_name = add_string(type.asString());
       }
+    }
 
-      const Json::Value *ref_node = NULL;
-
-      if (ref_uri.get_uri().empty()) {
-        ref_node = &refs_root_;
+    if (schema.isMember("allOf") && schema["allOf"].isArray()) {
+      node.keywords |= Node::ALL_OF;
+      node.all_of = compile_list(schema["allOf"], compiled);
+    }
+    if (schema.isMember("anyOf") && schema["anyOf"].isArray()) {
+      node.keywords |= Node::ANY_OF;
+      node.any_of = compile_list(schema["anyOf"], compiled);
+    }
+    if (schema.isMember("oneOf") && schema["oneOf"].isArray()) {
+      node.keywords |= Node::ONE_OF;
+      node.one_of = compile_list(schema["oneOf"], compiled);
+    }
+    if (schema.isMember("not")) {
+      node.keywords |= Node::NOT;
+      node.not_schema = compile(schema["not"], compiled);
+    }
+    if (schema.isMember("if") && (schema.isMember("then") || schema.isMember("else"))) {
+      node.keywords |= Node::IF;
+      node.if_schema = compile(schema["if"], compiled);
+      if (schema.isMember("then")) {
+        node.then_schema = compile(schema["then"], compiled);
       }
-      else {
-        auto it = ids.find(ref_uri.get_uri());
+      if (schema.isMember("else")) {
+        node.else_schema = compile(schema["else"], compiled);
+      }
+    }
 
-        if (it == ids.end()) {
-          SchemaValidator::Exception e(Exception::POINTER);
-          // TODO: more details in error message?
-          e.errors.push_back(Error("", "unresolved ref " + ref_string));
-          throw e;
+    if (schema.isMember("const")) {
+      node.keywords |= Node::CONST;
+      node.const_value = add_value(schema["const"]);
+    }
+    if (schema.isMember("enum")) {
+      node.keywords |= Node::ENUM;
+      node.enum_values.begin = static_cast<Json::UInt>(compiled_->values.size());
+      const Json::Value &choices = schema["enum"];
+      if (choices.isArray()) {
+        for (const Json::Value &choice : choices) {
+          add_value(choice);
         }
-
-        ref_node = it->second;
       }
+      node.enum_values.end = static_cast<Json::UInt>(compiled_->values.size());
+      node.enum_slots = compile_enum_slots(node.enum_values);
+    }
+    if (schema.isMember("default")) {
+      node.keywords |= Node::DEFAULT;
+      node.default_value = add_value(schema["default"]);
+    }
 
-      if (!fragment.empty()) {
-        try {
-          Pointer pointer(fragment);
-          const Json::Value &obj = pointer.get(*ref_node);
-          ref_node = &obj;
+    if (schema.isMember("required") && schema["required"].isArray()) {
+      node.keywords |= Node::REQUIRED;
+      node.required = compile_names(schema["required"]);
+    }
+    if (schema.isMember("minProperties")) {
+      node.keywords |= Node::MIN_PROPERTIES;
+      node.min_properties = schema["minProperties"].asUInt64();
+    }
+    if (schema.isMember("maxProperties")) {
+      node.keywords |= Node::MAX_PROPERTIES;
+      node.max_properties = schema["maxProperties"].asUInt64();
+    }
+    if (schema.isMember("properties") && schema["properties"].isObject()) {
+      node.keywords |= Node::PROPERTIES;
+      node.properties = compile_properties(schema["properties"], compiled);
+    }
+    if (schema.isMember("patternProperties") && schema["patternProperties"].isObject()) {
+      node.keywords |= Node::PATTERN_PROPERTIES;
+      node.pattern_properties = compile_properties(schema["patternProperties"], compiled);
+      compile_pattern_properties(node.pattern_properties);
+    }
+    if (schema.isMember("additionalProperties")) {
+      node.keywords |= Node::ADDITIONAL_PROPERTIES;
+      node.additional_properties = compile(schema["additionalProperties"], compiled);
+    }
+    if (schema.isMember("propertyNames")) {
+      node.keywords |= Node::PROPERTY_NAMES;
+      node.property_names = compile(schema["propertyNames"], compiled);
+    }
+    if (schema.isMember("dependencies") && schema["dependencies"].isObject()) {
+      const Json::Value &dependencies = schema["dependencies"];
+      std::vector<Dependency> entries;
+
+      for (auto name : dependencies.getMemberNames()) {
+        const Json::Value &dependency = dependencies[name];
+        Dependency entry;
+        entry.name = add_string(name);
+        if (dependency.isArray()) {
+          entry.schema = kNoNode;
+          entry.required = compile_names(dependency);
         }
-        catch (std::exception &ex) {
-          SchemaValidator::Exception e(Exception::POINTER);
-          // TODO: more details in error message?
-          e.errors.push_back(Error("", ex.what()));
-          throw e;
+        else {
+          entry.schema = compile(dependency, compiled);
         }
+        entries.push_back(entry);
       }
-#ifdef JSON_DEBUG_REF
-      printf("  (%p) recording ref %s -> %p\n", &node, ref_string.c_str(), ref_node);
-#endif
-      refs[&node] = ref_node;
+      std::sort(entries.begin(), entries.end(), [this](const Dependency &a, const Dependency &b) {
+        return compare_names(compiled_->chars(a.name), a.name.length, compiled_->chars(b.name), b.name.length) < 0;
+      });
+
+      node.keywords |= Node::DEPENDENCIES;
+      node.dependencies.begin = static_cast<Json::UInt>(compiled_->dependencies.size());
+      compiled_->dependencies.insert(compiled_->dependencies.end(), entries.begin(), entries.end());
+      node.dependencies.end = static_cast<Json::UInt>(compiled_->dependencies.size());
     }
-  }
-  else if (node.isMember("$id")) {
-    base_uri = base_uri.resolve(node["$id"].asString());
-    if (base_uri.has_fragment() && base_uri.get_fragment().empty()) {
-      base_uri.clear_fragment();
+
+    if (schema.isMember("minItems")) {
+      node.keywords |= Node::MIN_ITEMS;
+      node.min_items = schema["minItems"].asInt64();
     }
-    if (!process_refs) {
-#ifdef JSON_DEBUG_REF
-      printf("  id %s -> %p\n", base_uri.get_uri().c_str(), &node);
-#endif
-      ids[base_uri.get_uri()] = &node;
+    if (schema.isMember("maxItems")) {
+      node.keywords |= Node::MAX_ITEMS;
+      node.max_items = schema["maxItems"].asInt64();
     }
-  }
-
-  for (auto key : schema_member_names) {
-    if (node.isMember(key) && node[key].isObject()) {
-      collect_ids_refs(node[key], base_uri, process_refs);
+    if (schema.isMember("items")) {
+      const Json::Value &items = schema["items"];
+      if (items.isArray()) {
+        node.keywords |= Node::ITEMS_TUPLE;
+        node.items_tuple = compile_list(items, compiled);
+      }
+      else {
+        node.keywords |= Node::ITEMS;
+        node.items = compile(items, compiled);
+      }
+    }
+    if (schema.isMember("additionalItems")) {
+      node.keywords |= Node::ADDITIONAL_ITEMS;
+      node.additional_items = compile(schema["additionalItems"], compiled);
+    }
+    if (schema.isMember("uniqueItems") && schema["uniqueItems"].asBool()) {
+      node.keywords |= Node::UNIQUE_ITEMS;
+    }
+    if (schema.isMember("contains")) {
+      node.keywords |= Node::CONTAINS;
+      node.contains = compile(schema["contains"], compiled);
     }
-  }
 
-  for (auto key : schema_array_member_names) {
-    if (node.isMember(key) && node[key].isArray()) {
-      for (const Json::Value &child: node[key]) {
-        collect_ids_refs(child, base_uri, process_refs);
-      }
+    if (schema.isMember("minLength")) {
+      node.keywords |= Node::MIN_LENGTH;
+      node.min_length = schema["minLength"].asInt64();
+    }
+    if (schema.isMember("maxLength")) {
+      node.keywords |= Node::MAX_LENGTH;
+      node.max_length = schema["maxLength"].asInt64();
+    }
+    if (schema.isMember("pattern")) {
+      node.keywords |= Node::PATTERN;
+      node.pattern = add_string(schema["pattern"].asString());
+      node.pattern_regex = add_regex(schema["pattern"].asString());
     }
-  }
 
-  for (auto key : schema_object_member_names) {
-    if (node.isMember(key)) {
-      const Json::Value &member = node[key];
-      for (auto name : member.getMemberNames()) {
-        collect_ids_refs(member[name], base_uri, process_refs);
-      }
+    if (schema.isMember("minimum")) {
+      node.keywords |= Node::MINIMUM;
+      node.minimum = schema["minimum"].asDouble();
+    }
+    if (schema.isMember("exclusiveMinimum")) {
+      node.keywords |= Node::EXCLUSIVE_MINIMUM;
+      node.exclusive_minimum = schema["exclusiveMinimum"].asDouble();
+    }
+    if (schema.isMember("maximum")) {
+      node.keywords |= Node::MAXIMUM;
+      node.maximum = schema["maximum"].asDouble();
+    }
+    if (schema.isMember("exclusiveMaximum")) {
+      node.keywords |= Node::EXCLUSIVE_MAXIMUM;
+      node.exclusive_maximum = schema["exclusiveMaximum"].asDouble();
+    }
+    if (schema.isMember("multipleOf")) {
+      node.keywords |= Node::MULTIPLE_OF;
+      node.multiple_of = schema["multipleOf"].asDouble();
     }
   }
+
+  compiled_->nodes[index] = node;
+  return index;
 }
 
 
-SchemaValidator::~SchemaValidator() {}
+SchemaValidator::Range SchemaValidator::compile_list(const Json::Value &schemata, std::unordered_map<const Json::Value *, NodeIndex> *compiled) {
+  std::vector<NodeIndex> indices;
 
-std::vector<SchemaValidator::Error> SchemaValidator::errors(std::string prefix) const {
-  auto orig_errors = errors();
-  std::vector<SchemaValidator::Error> prefixed_errors;
-  for (auto it = orig_errors.begin(); it != orig_errors.end(); it++) {
-    prefixed_errors.push_back(Error(prefix + it->path, it->message));
+  for (const Json::Value &schema : schemata) {
+    indices.push_back(compile(schema, compiled));
   }
-  return prefixed_errors;
-}
 
-bool SchemaValidator::validate(const Json::Value &instance) {
-  return validate(instance, &errors_);
+  Range range;
+  range.begin = static_cast<Json::UInt>(compiled_->node_lists.size());
+  compiled_->node_lists.insert(compiled_->node_lists.end(), indices.begin(), indices.end());
+  range.end = static_cast<Json::UInt>(compiled_->node_lists.size());
+  return range;
 }
 
-bool SchemaValidator::validate(const Json::Value &instance, std::vector<Error> *errors) const {
-  /// \todo fix non-relative $ref
-  /// \todo walk schema and record all ids in types_
-  /// \todo get rid of asserts (CHECK)?
-#ifdef JSON_DEBUG_REF
-  printf("validate: root: %p, schema: %p, instance %p\n", &refs_root_, schema_root_, &instance);
-#endif
-  ValidationContext context(errors);
-  
-  Validate(instance, *schema_root_, "/", ExpansionOptions(), &context);
-  return context.is_valid();
-}
 
-bool SchemaValidator::validate_and_expand(Json::Value &instance, const ExpansionOptions &options) {
-  return validate_and_expand(instance, options , &errors_);
-}
+SchemaValidator::Range SchemaValidator::compile_properties(const Json::Value &properties, std::unordered_map<const Json::Value *, NodeIndex> *compiled) {
+  std::vector<Property> entries;
 
-bool SchemaValidator::validate_and_expand(Json::Value &instance, const ExpansionOptions &options, std::vector<Error> *errors) const {
-  ValidationContext context(errors);
-  
-  Validate(instance, *schema_root_, "/", options, &context);
-  
-  if (context.is_valid()) {
-    for (auto add_value : context.add_values) {
-      Json::Value *parent = const_cast<Json::Value *>(add_value.parent);
-      (*parent)[add_value.name] = *(add_value.value);
-    }
+  for (auto name : properties.getMemberNames()) {
+    Property entry;
+    entry.name = add_string(name);
+    entry.schema = compile(properties[name], compiled);
+    entries.push_back(entry);
   }
-  return context.is_valid();
+  std::sort(entries.begin(), entries.end(), [this](const Property &a, const Property &b) {
+    return compare_names(compiled_->chars(a.name), a.name.length, compiled_->chars(b.name), b.name.length) < 0;
+  });
+
+  Range range;
+  range.begin = static_cast<Json::UInt>(compiled_->properties.size());
+  compiled_->properties.insert(compiled_->properties.end(), entries.begin(), entries.end());
+  range.end = static_cast<Json::UInt>(compiled_->properties.size());
+  return range;
 }
 
 
-bool SchemaValidator::isValid(const Json::Value &instance, const Json::Value &schema, const ExpansionOptions &options, ValidationContext *context) const {
-  auto errors_before = context->get_error_size();
-  auto add_values_before = context->get_add_values_size();
-  
-  Validate(instance, schema, "", options, context);
-  
-  auto ok = context->get_error_size() == errors_before;
-  
-  if (!ok) {
-    context->truncate_errors(errors_before);
-    context->truncate_add_values(add_values_before);
+SchemaValidator::Range SchemaValidator::compile_names(const Json::Value &names) {
+  Range range;
+  range.begin = static_cast<Json::UInt>(compiled_->names.size());
+  for (const Json::Value &name : names) {
+    compiled_->names.push_back(add_string(name.asString()));
   }
-  
-  return ok;
+  range.end = static_cast<Json::UInt>(compiled_->names.size());
+  return range;
 }
 
-void SchemaValidator::Validate(const Json::Value &instance, const Json::Value &schema,
-const std::string& path, const ExpansionOptions &options, ValidationContext *context) const {
-  if (schema.isBool()) {
-      if (schema.asBool() == false) {
-        context->add_error(Error(path, kFalse));
-      }
-      return;
+
+SchemaValidator::StringRef SchemaValidator::add_string(const std::string &str) {
+  StringRef ref(static_cast<Json::UInt>(compiled_->strings.size()), static_cast<Json::UInt>(str.length()));
+  compiled_->strings.append(str);
+  return ref;
+}
+
+
+Json::UInt SchemaValidator::add_value(const Json::Value &value) {
+  compiled_->values.push_back(value);
+  compiled_->value_hashes.push_back(hash_value(value));
+  return static_cast<Json::UInt>(compiled_->values.size() - 1);
+}
+
+
+SchemaValidator::Range SchemaValidator::compile_enum_slots(const Range &values) {
+  Range range;
+  range.begin = range.end = static_cast<Json::UInt>(compiled_->enum_slots.size());
+
+  if (values.size() < kEnumHashMinimum) {
+    return range;
   }
 
-  // If the schema has a $ref property, the instance must validate against
-  // that schema. It must be present in types_ to be referenced.
-  if (schema.isMember("$ref")) {
-    auto real_schema = resolve_ref(&schema);
-    if (real_schema == NULL) {
-#ifdef JSON_DEBUG_REF
-      printf("  (%p) unresolved ref %s\n", &schema, schema["$ref"].asCString());
-#endif
-      // should not happen
-      context->add_error(Error(path, FormatErrorMessage(kUnknownTypeReference, schema["$ref"].asString())));
-    }
-    else {
-#ifdef JSON_DEBUG_REF
-      printf("  (%p) looking up ref %s -> %p\n", &schema, schema["$ref"].asCString(), real_schema);
-#endif
-      Validate(instance, *real_schema, path, options, context);
-    }
-    return;
+  // At most half full, so probe sequences stay short.
+  Json::UInt size = 1;
+  while (size < 2 * values.size()) {
+    size *= 2;
   }
+  compiled_->enum_slots.resize(range.begin + size, Json::UInt(kNoValue));
+  range.end = range.begin + size;
 
-  // If the schema has a choices property, the instance must validate against at
-  // least one of the items in that array.
-  if (schema.isMember("type")) {
-    if (!ValidateType(instance, schema["type"], path, context)) {
-      return;
+  for (auto i = values.begin; i < values.end; i++) {
+    auto slot = compiled_->value_hashes[i] & (size - 1);
+    while (compiled_->enum_slots[range.begin + slot] != kNoValue) {
+      slot = (slot + 1) & (size - 1);
     }
+    compiled_->enum_slots[range.begin + slot] = i;
   }
 
-  if (schema.isMember("allOf")) {
-    const Json::Value &schemata = schema["allOf"];
+  return range;
+}
+
 
-    for (Json::ArrayIndex i = 0; i < schemata.size(); i++) {
-      Validate(instance, schemata[i], path, options, context);
-    }
-  }
-  if (schema.isMember("anyOf")) {
-    const Json::Value &schemata = schema["anyOf"];
-    bool ok = false;
-    
-    for (Json::ArrayIndex i = 0; i < schemata.size(); i++) {
-      if (isValid(instance, schemata[i], options, context)) {
-        ok = true;
-        if (!options.add_defaults) {
-          break;
+// Computes the preconditions of the branches in |list|. Returns whether a discriminator was found.
+bool SchemaValidator::compile_branches(const Range &list, StringRef *discriminator) {
+  // Candidate discriminators are required members with const or enum, counted by the number of
+  // branches they appear in.
+  std::map<std::string, std::pair<StringRef, Json::UInt> > candidates;
+
+  for (auto i = list.begin; i < list.end; i++) {
+    compiled_->branches[i].types = accepted_types(compiled_->node_lists[i], 0);
+
+    const Node &node = follow_refs(compiled_->node_lists[i]);
+    if (node.has(Node::REQUIRED)) {
+      for (auto j = node.required.begin; j < node.required.end; j++) {
+        const StringRef &name = compiled_->names[j];
+        Range values;
+        if (find_discriminator(compiled_->node_lists[i], name, &values)) {
+          auto &candidate = candidates[compiled_->string(name)];
+          candidate.first = name;
+          candidate.second++;
         }
       }
     }
+  }
 
-    if (!ok) {
-      context->add_error(Error(path, kAnyOfFailed));
+  const std::pair<StringRef, Json::UInt> *best = NULL;
+  for (const auto &candidate : candidates) {
+    if (best == NULL || candidate.second.second > best->second) {
+      best = &candidate.second;
     }
   }
-  if (schema.isMember("oneOf")) {
-    const Json::Value &schemata = schema["oneOf"];
-    size_t matched = 0;
-    
-    for (Json::ArrayIndex i = 0; i < schemata.size(); i++) {
-      if (isValid(instance, schemata[i], options, context)) {
-        matched++;
-      }
-    }
-    
-    if (matched != 1) {
-      context->add_error(Error(path, kOneOfFailed));
+  // With a single branch, there is nothing to select.
+  if (best == NULL || best->second < 2) {
+    return false;
+  }
+
+  *discriminator = best->first;
+  for (auto i = list.begin; i < list.end; i++) {
+    find_discriminator(compiled_->node_lists[i], *discriminator, &compiled_->branches[i].discriminator_values);
+  }
+  return true;
+}
+
+
+static const unsigned int kAllTypes = 0xffffffff;
+// Maximum depth of $ref and allOf followed when computing branch preconditions.
+static const unsigned int kMaxBranchDepth = 16;
+
+
+const SchemaValidator::Node &SchemaValidator::follow_refs(NodeIndex index) const {
+  for (unsigned int depth = 0; depth < kMaxBranchDepth && compiled_->nodes[index].has(Node::REF) && compiled_->nodes[index].ref != kNoNode; depth++) {
+    index = compiled_->nodes[index].ref;
+  }
+  return compiled_->nodes[index];
+}
+
+
+unsigned int SchemaValidator::accepted_types(NodeIndex index, unsigned int depth) const {
+  if (depth >= kMaxBranchDepth) {
+    return kAllTypes;
+  }
+
+  const Node &node = compiled_->nodes[index];
+  if (node.has(Node::FALSE_SCHEMA)) {
+    return 0;
+  }
+  if (node.has(Node::REF)) {
+    return node.ref == kNoNode ? 0 : accepted_types(node.ref, depth + 1);
+  }
+
+  auto types = kAllTypes;
+  if (node.has(Node::TYPE)) {
+    types &= node.types;
+  }
+  if (node.has(Node::CONST | Node::ENUM)) {
+    // Numbers of either kind can be equal.
+    auto value_types = [](const Json::Value &value) {
+      auto type = type_bit(value);
+      return type & (TYPE_INTEGER | TYPE_NUMBER) ? TYPE_INTEGER | TYPE_NUMBER : type;
+    };
+    if (node.has(Node::CONST)) {
+      types &= value_types(compiled_->values[node.const_value]);
+    }
+    if (node.has(Node::ENUM)) {
+      unsigned int enum_types = 0;
+      for (auto i = node.enum_values.begin; i < node.enum_values.end; i++) {
+        enum_types |= value_types(compiled_->values[i]);
+      }
+      types &= enum_types;
+    }
+  }
+  if (node.has(Node::ALL_OF)) {
+    for (auto i = node.all_of.begin; i < node.all_of.end; i++) {
+      types &= accepted_types(compiled_->node_lists[i], depth + 1);
+    }
+  }
+  // At least one branch has to accept the instance.
+  const Range *lists[] = { node.has(Node::ANY_OF) ? &node.any_of : NULL, node.has(Node::ONE_OF) ? &node.one_of : NULL };
+  for (auto list : lists) {
+    if (list != NULL) {
+      unsigned int list_types = 0;
+      for (auto i = list->begin; i < list->end; i++) {
+        list_types |= accepted_types(compiled_->node_lists[i], depth + 1);
+      }
+      types &= list_types;
+    }
+  }
+  return types;
+}
+
+
+// Whether the node at |index| requires member |name| with a value from a const or enum, which is returned in |values|.
+bool SchemaValidator::find_discriminator(NodeIndex index, const StringRef &name, Range *values) const {
+  const Node &node = follow_refs(index);
+  // enum ends validation before object keywords are checked.
+  if (!node.has(Node::REQUIRED) || !node.has(Node::PROPERTIES) || node.has(Node::REF | Node::ENUM)) {
+    return false;
+  }
+
+  const char *name_begin = compiled_->chars(name);
+  auto required = false;
+  for (auto i = node.required.begin; i < node.required.end; i++) {
+    if (compare_names(compiled_->chars(compiled_->names[i]), compiled_->names[i].length, name_begin, name.length) == 0) {
+      required = true;
+      break;
+    }
+  }
+  auto property = find_property(node.properties, name_begin, name_begin + name.length);
+  if (!required || property == NULL) {
+    return false;
+  }
+
+  const Node &member = follow_refs(property->schema);
+  if (member.has(Node::REF | Node::FALSE_SCHEMA)) {
+    return false;
+  }
+  if (member.has(Node::CONST)) {
+    *values = Range(member.const_value, member.const_value + 1);
+    return true;
+  }
+  if (member.has(Node::ENUM)) {
+    *values = member.enum_values;
+    return true;
+  }
+  return false;
+}
+
+
+SchemaValidator::Discriminator SchemaValidator::discriminate(const Json::Value &instance, unsigned int type, bool has_discriminator, const StringRef &name) const {
+  Discriminator discriminator;
+
+  if (has_discriminator && type == TYPE_OBJECT) {
+    const char *name_begin = compiled_->chars(name);
+    discriminator.check = true;
+    discriminator.value = instance.find(name_begin, name_begin + name.length);
+    if (discriminator.value != NULL) {
+      discriminator.hash = hash_value(*discriminator.value);
+    }
+  }
+  return discriminator;
+}
+
+
+bool SchemaValidator::is_candidate(const Branch &branch, unsigned int type, const Discriminator &discriminator) const {
+  if ((branch.types & type) == 0) {
+    return false;
+  }
+  if (!discriminator.check || branch.discriminator_values.size() == 0) {
+    return true;
+  }
+  if (discriminator.value == NULL) {
+    // The branch requires the member.
+    return false;
+  }
+  for (auto i = branch.discriminator_values.begin; i < branch.discriminator_values.end; i++) {
+    if (compiled_->value_hashes[i] == discriminator.hash && values_equal(compiled_->values[i], *discriminator.value)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+Json::UInt SchemaValidator::add_regex(const std::string &pattern) {
+  std::shared_ptr<const Regex> regex(new Regex(pattern, regex_match_limit, regex_depth_limit));
+  if (!regex->error().empty()) {
+    SchemaValidator::Exception e(Exception::SCHEMA_VALIDATION);
+    e.errors.push_back(Error("", "invalid pattern '" + pattern + "': " + regex->error()));
+    throw e;
+  }
+  compiled_->regexes.push_back(regex);
+  return static_cast<Json::UInt>(compiled_->regexes.size() - 1);
+}
+
+
+void SchemaValidator::compile_pattern_properties(const Range &range) {
+  for (auto i = range.begin; i < range.end; i++) {
+    Property &property = compiled_->properties[i];
+    property.regex = add_regex(compiled_->string(property.name));
+  }
+}
+
+
+void SchemaValidator::collect_ids_refs(const Json::Value &node, URI base_uri, bool process_refs) {
+  if (!process_refs) {
+    sub_schemata.insert(&node);
+  }
+
+  if (!node.isObject()) {
+    return;
+  }
+  if (node.isMember("$ref")) {
+    if (process_refs) {
+      auto ref_uri = base_uri.resolve(node["$ref"].asString());
+      load_remote(ref_uri);
+      auto ref_node = find_schema(ref_uri);
+#ifdef JSON_DEBUG_REF
+      printf("  (%p) recording ref %s -> %p\n", &node, node["$ref"].asCString(), ref_node);
+#endif
+      refs[&node] = ref_node;
+      ref_uri.clear_fragment();
+      ref_bases.insert(std::make_pair(ref_node, ref_uri));
+    }
+  }
+  else if (node.isMember("$id")) {
+    base_uri = base_uri.resolve(node["$id"].asString());
+    if (base_uri.has_fragment() && base_uri.get_fragment().empty()) {
+      base_uri.clear_fragment();
+    }
+    if (!process_refs) {
+#ifdef JSON_DEBUG_REF
+      printf("  id %s -> %p\n", base_uri.get_uri().c_str(), &node);
+#endif
+      ids[base_uri.get_uri()] = &node;
+    }
+  }
+
+  for (auto key : schema_member_names) {
+    if (node.isMember(key) && node[key].isObject()) {
+      collect_ids_refs(node[key], base_uri, process_refs);
+    }
+  }
+
+  for (auto key : schema_array_member_names) {
+    if (node.isMember(key) && node[key].isArray()) {
+      for (const Json::Value &child: node[key]) {
+        collect_ids_refs(child, base_uri, process_refs);
+      }
+    }
+  }
+
+  for (auto key : schema_object_member_names) {
+    if (node.isMember(key)) {
+      const Json::Value &member = node[key];
+      for (auto name : member.getMemberNames()) {
+        collect_ids_refs(member[name], base_uri, process_refs);
+      }
+    }
+  }
+}
+
+
+void SchemaValidator::load_remote(URI uri) {
+  uri.clear_fragment();
+  auto document_uri = uri.get_uri();
+  if (!resolver_ || document_uri.empty() || ids.find(document_uri) != ids.end()) {
+    return;
+  }
+
+  auto document = resolver_->resolve(document_uri, !trusted_);
+  if (!document) {
+    return;
+  }
+  remote_documents.push_back(document);
+  ids[document_uri] = document.get();
+  collect_ids_refs(*document, uri, false);
+  collect_ids_refs(*document, uri, true);
+}
+
+
+// Returns the schema |uri| refers to, which is either a known $id or a JSON pointer into one.
+const Json::Value *SchemaValidator::find_schema(URI uri) const {
+  auto ref_string = uri.get_uri();
+  std::string fragment;
+
+  if (uri.has_fragment()) {
+    fragment = uri.get_fragment();
+  }
+
+  if (fragment.empty()) {
+    uri.clear_fragment();
+  }
+  else {
+    if (fragment[0] == '/') {
+      uri.clear_fragment();
+    }
+    else {
+      fragment = "";
+    }
+  }
+
+  const Json::Value *ref_node = NULL;
+
+  if (uri.get_uri().empty()) {
+    ref_node = &refs_root_;
+  }
+  else {
+    auto it = ids.find(uri.get_uri());
+
+    if (it == ids.end()) {
+      SchemaValidator::Exception e(Exception::POINTER);
+      // TODO: more details in error message?
+      e.errors.push_back(Error("", "unresolved ref " + ref_string));
+      throw e;
+    }
+
+    ref_node = it->second;
+  }
+
+  if (!fragment.empty()) {
+    try {
+      Pointer pointer(fragment);
+      const Json::Value &obj = pointer.get(*ref_node);
+      ref_node = &obj;
+    }
+    catch (std::exception &ex) {
+      SchemaValidator::Exception e(Exception::POINTER);
+      // TODO: more details in error message?
+      e.errors.push_back(Error("", ex.what()));
+      throw e;
+    }
+  }
+
+  return ref_node;
+}
+
+
+SchemaValidator::~SchemaValidator() {}
+
+std::vector<SchemaValidator::Error> SchemaValidator::errors(std::string prefix) const {
+  return prefix_errors(prefix, errors());
+}
+
+// static
+std::vector<SchemaValidator::Error> SchemaValidator::prefix_errors(const std::string &prefix, const std::vector<Error> &errors) {
+  std::vector<SchemaValidator::Error> prefixed_errors;
+  for (auto it = errors.begin(); it != errors.end(); it++) {
+    prefixed_errors.push_back(Error(prefix + it->path, it->message));
+  }
+  return prefixed_errors;
+}
+
+bool SchemaValidator::validate(const Json::Value &instance) {
+  return validate(instance, &errors_);
+}
+
+bool SchemaValidator::validate(const Json::Value &instance, std::vector<Error> *errors) const {
+  /// \todo fix non-relative $ref
+  /// \todo walk schema and record all ids in types_
+  /// \todo get rid of asserts (CHECK)?
+#ifdef JSON_DEBUG_REF
+  printf("validate: root: %p, schema: %p, instance %p\n", &refs_root_, schema_root_, &instance);
+#endif
+  Json::UInt64 hash = 0;
+  if (result_cache_) {
+    bool valid;
+    hash = hash_value(instance);
+    if (result_cache_->find(hash, instance, &valid, errors)) {
+      return valid;
+    }
+  }
+
+  ValidationContext context(errors, max_errors_, memoize_);
+  
+  Apply(instance, root_, Path(), ExpansionOptions(), &context);
+
+  if (result_cache_ && (errors != NULL || context.is_valid())) {
+    result_cache_->insert(hash, instance, context.is_valid(), errors != NULL ? *errors : std::vector<Error>());
+  }
+  return context.is_valid();
+}
+
+bool SchemaValidator::validate_and_expand(Json::Value &instance, const ExpansionOptions &options) {
+  return validate_and_expand(instance, options , &errors_);
+}
+
+bool SchemaValidator::validate_and_expand(Json::Value &instance, const ExpansionOptions &options, std::vector<Error> *errors) const {
+  ValidationContext context(errors, max_errors_, memoize_);
+  
+  Apply(instance, root_, Path(), options, &context);
+  
+  if (context.is_valid()) {
+    for (auto add_value : context.add_values) {
+      Json::Value *parent = const_cast<Json::Value *>(add_value.parent);
+      (*parent)[add_value.name] = *(add_value.value);
+    }
+  }
+  return context.is_valid();
+}
+
+
+bool SchemaValidator::is_valid(const Json::Value &instance) const {
+  Json::UInt64 hash = 0;
+  if (result_cache_) {
+    bool valid;
+    hash = hash_value(instance);
+    if (result_cache_->find(hash, instance, &valid, NULL)) {
+      return valid;
+    }
+  }
+
+  ValidationContext context(NULL, 0, memoize_);
+
+  Apply(instance, root_, Path(), ExpansionOptions(), &context);
+
+  // Without errors, only a valid result can be reused by validate().
+  if (result_cache_ && context.is_valid()) {
+    result_cache_->insert(hash, instance, true, std::vector<Error>());
+  }
+  return context.is_valid();
+}
+
+
+bool SchemaValidator::validate_document(const std::string &document, std::vector<Error> *errors) const {
+  bool valid;
+  if (result_cache_ && result_cache_->find(document, &valid, errors)) {
+    return valid;
+  }
+
+  Json::Reader reader;
+  Json::Value instance;
+  std::vector<Error> local_errors;
+  if (errors == NULL) {
+    errors = &local_errors;
+  }
+
+  if (!reader.parse(document, instance)) {
+    errors->clear();
+    for (const auto &error : reader.getStructuredErrors()) {
+      auto begin = document.begin() + static_cast<ptrdiff_t>(error.offset_start);
+      auto line = std::count(document.begin(), begin, '\n') + 1;
+      auto column = begin - std::find(std::string::const_reverse_iterator(begin), document.rend(), '\n').base() + 1;
+      errors->push_back(Error("", "line " + std::to_string(line) + ", column " + std::to_string(column) + ": " + error.message));
+    }
+    valid = false;
+  }
+  else {
+    ValidationContext context(errors, max_errors_, memoize_);
+
+    Apply(instance, root_, Path(), ExpansionOptions(), &context);
+    valid = context.is_valid();
+  }
+
+  if (result_cache_) {
+    result_cache_->insert(document, valid, *errors);
+  }
+  return valid;
+}
+
+
+SchemaValidator::CacheStatistics SchemaValidator::cache_statistics() const {
+  if (!result_cache_) {
+    return CacheStatistics();
+  }
+  return result_cache_->statistics();
+}
+
+
+bool SchemaValidator::isValid(const Json::Value &instance, NodeIndex schema, const ExpansionOptions &options, ValidationContext *context) const {
+  auto ok = false;
+  // With defaults, the branch has side effects.
+  if (!options.add_defaults && context->find_memo(instance, schema, &ok)) {
+    return ok;
+  }
+
+  auto add_values_before = context->get_add_values_size();
+  auto saved = context->begin_branch();
+  
+  // Errors are discarded, so the path doesn't matter.
+  Apply(instance, schema, Path(), options, context);
+  
+  ok = context->end_branch(saved);
+  
+  if (!ok) {
+    context->truncate_add_values(add_values_before);
+  }
+  if (!options.add_defaults) {
+    context->add_memo(instance, schema, ok);
+  }
+  
+  return ok;
+}
+
+void SchemaValidator::Validate(const Json::Value &instance, NodeIndex index,
+const Path& path, const ExpansionOptions &options, ValidationContext *context) const {
+  const Node &schema = compiled_->nodes[index];
+
+  if (schema.has(Node::FALSE_SCHEMA)) {
+    context->add_error([&] { return Error(path.str(), kFalse); });
+    return;
+  }
+
+  // If the schema has a $ref property, the instance must validate against
+  // that schema.
+  if (schema.has(Node::REF)) {
+    if (schema.ref == kNoNode) {
+      // should not happen
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kUnknownTypeReference, compiled_->string(schema.ref_name))); });
+    }
+    else {
+#ifdef JSON_DEBUG_REF
+      printf("  (%u) looking up ref %s -> %u\n", index, compiled_->string(schema.ref_name).c_str(), schema.ref);
+#endif
+      Validate(instance, schema.ref, path, options, context);
+    }
+    return;
+  }
+
+  const unsigned int type = type_bit(instance);
+
+  // If the schema has a type property, the instance must be of one of the
+  // listed types.
+  if (schema.has(Node::TYPE)) {
+    if (!ValidateType(type, schema, path, context)) {
+      return;
+    }
+  }
+
+  if (schema.has(Node::ALL_OF)) {
+    for (auto i = schema.all_of.begin; i < schema.all_of.end; i++) {
+      Validate(instance, compiled_->node_lists[i], path, options, context);
+      if (context->stopped()) {
+        return;
+      }
+    }
+  }
+  if (schema.has(Node::ANY_OF)) {
+    bool ok = false;
+    auto discriminator = discriminate(instance, type, schema.has(Node::ANY_OF_DISCRIMINATOR), schema.any_of_discriminator);
+    
+    for (auto i = schema.any_of.begin; i < schema.any_of.end; i++) {
+      if (!is_candidate(compiled_->branches[i], type, discriminator)) {
+        continue;
+      }
+      if (isValid(instance, compiled_->node_lists[i], options, context)) {
+        ok = true;
+        if (!options.add_defaults) {
+          break;
+        }
+      }
+    }
+
+    if (!ok) {
+      context->add_error([&] { return Error(path.str(), kAnyOfFailed); });
+      if (context->stopped()) {
+        return;
+      }
+    }
+  }
+  if (schema.has(Node::ONE_OF)) {
+    size_t matched = 0;
+    auto discriminator = discriminate(instance, type, schema.has(Node::ONE_OF_DISCRIMINATOR), schema.one_of_discriminator);
+    
+    for (auto i = schema.one_of.begin; i < schema.one_of.end; i++) {
+      if (!is_candidate(compiled_->branches[i], type, discriminator)) {
+        continue;
+      }
+      if (isValid(instance, compiled_->node_lists[i], options, context)) {
+        // A second match decides the result.
+        if (++matched > 1) {
+          break;
+        }
+      }
+    }
+    
+    if (matched != 1) {
+      context->add_error([&] { return Error(path.str(), kOneOfFailed); });
+      if (context->stopped()) {
+        return;
+      }
     }
   }
-  if (schema.isMember("not")) {
-    if (isValid(instance, schema["not"], ExpansionOptions(), context)) {
-      context->add_error(Error(path, kNotFailed));
+  if (schema.has(Node::NOT)) {
+    if (isValid(instance, schema.not_schema, ExpansionOptions(), context)) {
+      context->add_error([&] { return Error(path.str(), kNotFailed); });
+      if (context->stopped()) {
+        return;
+      }
     }
   }
 
-  if (schema.isMember("if") && (schema.isMember("then") || schema.isMember("else"))) {
-    if (isValid(instance, schema["if"], ExpansionOptions(), context)) {
-      if (schema.isMember("then")) {
-        Validate(instance, schema["then"], path, options, context);
+  if (schema.has(Node::IF)) {
+    if (isValid(instance, schema.if_schema, ExpansionOptions(), context)) {
+      if (schema.then_schema != kNoNode) {
+        Validate(instance, schema.then_schema, path, options, context);
       }
     }
     else {
-      if (schema.isMember("else")) {
-        Validate(instance, schema["else"], path, options, context);
+      if (schema.else_schema != kNoNode) {
+        Validate(instance, schema.else_schema, path, options, context);
       }
     }
+    if (context->stopped()) {
+      return;
+    }
   }
 
-  if (schema.isMember("const")) {
-    if (instance != schema["const"]) {
-      context->add_error(Error(path, kConst));
+  if (schema.has(Node::CONST)) {
+    if (!values_equal(instance, compiled_->values[schema.const_value])) {
+      context->add_error([&] { return Error(path.str(), kConst); });
+      if (context->stopped()) {
+        return;
+      }
     }
   }
   // If the schema has an enum property, the instance must be one of those
   // values.
-  if (schema.isMember("enum")) {
-    ValidateEnum(instance, schema["enum"], path, context);
+  if (schema.has(Node::ENUM)) {
+    ValidateEnum(instance, schema, path, context);
     return;
   }
 
-  if (instance.isNull() || instance.isBool())
-    return;
-  else if (instance.isObject())
-    ValidateObject(instance, schema, path, options, context);
-  else if (instance.isArray())
-    ValidateArray(instance, schema, path, options, context);
-  else if (instance.isString())
-    ValidateString(instance, schema, path, context);
-  else if (instance.isNumeric())
-    ValidateNumber(instance, schema, path, context);
-}
-
-bool SchemaValidator::ValidateChoices(const Json::Value &instance, const Json::Value &choices,
-const std::string& path, ValidationContext *context) const {
-  size_t original_num_errors = context->get_error_size();
-
-  for (Json::Value::ArrayIndex i = 0; i < choices.size(); ++i) {
-    if (ValidateSimpleType(instance, choices[i].asString(), path, context)) {
-      return true;
-    }
-    // We discard the error from each choice. We only want to know if any of the
-    // validations succeeded.
-    context->truncate_errors(original_num_errors);
+  switch (type) {
+    case TYPE_OBJECT:
+      if (schema.has(Node::OBJECT_KEYWORDS))
+        ValidateObject(instance, schema, path, options, context);
+      break;
+
+    case TYPE_ARRAY:
+      if (schema.has(Node::ARRAY_KEYWORDS))
+        ValidateArray(instance, schema, path, options, context);
+      break;
+
+    case TYPE_STRING:
+      if (schema.has(Node::STRING_KEYWORDS))
+        ValidateString(instance, schema, path, context);
+      break;
+
+    case TYPE_INTEGER:
+    case TYPE_NUMBER:
+      if (schema.has(Node::NUMBER_KEYWORDS))
+        ValidateNumber(instance, schema, path, context);
+      break;
   }
-  
-  // TODO: better error message
-  // Now add a generic error that no choices matched.
-  context->add_error(Error(path, kInvalidChoice));
-  return false;
 }
 
-void SchemaValidator::ValidateEnum(const Json::Value &instance, const Json::Value &choices,
-const std::string& path, ValidationContext *context) const {
-  for (Json::Value::ArrayIndex i = 0; i < choices.size(); ++i) {
-    if (choices[i] == instance) {
-      return;
+void SchemaValidator::ValidateEnum(const Json::Value &instance, const Node &schema,
+const Path& path, ValidationContext *context) const {
+  if (!find_enum(schema, instance)) {
+    context->add_error([&] { return Error(path.str(), kInvalidEnum); });
+  }
+}
+
+
+bool SchemaValidator::find_enum(const Node &schema, const Json::Value &value) const {
+  if (schema.enum_slots.size() == 0) {
+    // Few values, hashing the instance costs more than comparing.
+    for (auto i = schema.enum_values.begin; i < schema.enum_values.end; ++i) {
+      if (values_equal(compiled_->values[i], value)) {
+        return true;
+      }
     }
+    return false;
   }
 
-  context->add_error(Error(path, kInvalidEnum));
+  auto hash = hash_value(value);
+  auto mask = schema.enum_slots.size() - 1;
+  for (auto slot = hash & mask; ; slot = (slot + 1) & mask) {
+    auto index = compiled_->enum_slots[schema.enum_slots.begin + slot];
+    if (index == kNoValue) {
+      return false;
+    }
+    if (compiled_->value_hashes[index] == hash && values_equal(compiled_->values[index], value)) {
+      return true;
+    }
+  }
 }
 
-void SchemaValidator::ValidateObject(const Json::Value &instance, const Json::Value &schema,
-const std::string& path, const ExpansionOptions &options, ValidationContext *context) const {
-  if (schema.isMember("required")) {
-    const Json::Value &required = schema["required"];
-    for (Json::ArrayIndex i = 0; i < required.size(); i++) {
-      if (!instance.isMember(required[i].asString())) {
-        context->add_error(Error(path, FormatErrorMessage(kObjectPropertyIsRequired, required[i].asString())));
+void SchemaValidator::ValidateObject(const Json::Value &instance, const Node &schema,
+const Path& path, const ExpansionOptions &options, ValidationContext *context) const {
+  if (schema.has(Node::REQUIRED)) {
+    for (auto i = schema.required.begin; i < schema.required.end; i++) {
+      const StringRef &name = compiled_->names[i];
+      const char *name_begin = compiled_->chars(name);
+      if (instance.find(name_begin, name_begin + name.length) == NULL) {
+        context->add_error([&] { return Error(path.str(), FormatErrorMessage(kObjectPropertyIsRequired, compiled_->string(name))); });
+        if (context->stopped()) {
+          return;
+        }
       }
     }
   }
   
-  if (schema.isMember("minProperties")) {
-    Json::UInt64 count = schema["minProperties"].asUInt();
-    
-    if (instance.size() < count) {
-      context->add_error(Error(path, FormatErrorMessage(kObjectMinProperties, UIntToString(count))));
+  if (schema.has(Node::MIN_PROPERTIES)) {
+    if (instance.size() < schema.min_properties) {
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kObjectMinProperties, UIntToString(schema.min_properties))); });
     }
   }
 
-  if (schema.isMember("maxProperties")) {
-    Json::UInt64 count = schema["maxProperties"].asUInt();
-    
-    if (instance.size() > count) {
-      context->add_error(Error(path, FormatErrorMessage(kObjectMaxProperties, UIntToString(count))));
+  if (schema.has(Node::MAX_PROPERTIES)) {
+    if (instance.size() > schema.max_properties) {
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kObjectMaxProperties, UIntToString(schema.max_properties))); });
     }
   }
 
-  const Json::Value *properties = schema.isMember("properties") ? &schema["properties"] : NULL;
-  const Json::Value *property_names = schema.isMember("propertyNames") ? &schema["propertyNames"] : NULL;
-  const Json::Value *additional_properties = schema.isMember("additionalProperties") ? &schema["additionalProperties"] : NULL;
-  std::vector<std::pair<pcrecpp::RE, const Json::Value *> >pattern_properties;
-  if (schema.isMember("patternProperties")) {
-    const Json::Value &pattern = schema["patternProperties"];
-    for (auto name : pattern.getMemberNames()) {
-      pattern_properties.push_back(std::pair<pcrecpp::RE, const Json::Value *>(pcrecpp::RE(name), &pattern[name]));
-    }
+  if (schema.has(Node::PROPERTIES | Node::PATTERN_PROPERTIES | Node::ADDITIONAL_PROPERTIES | Node::PROPERTY_NAMES | Node::DEPENDENCIES)) {
+    ValidateMembers(instance, schema, path, options, context);
   }
-  const Json::Value *dependencies = schema.isMember("dependencies") ? &schema["dependencies"] : NULL;
 
-  for (auto name : instance.getMemberNames()) {
-    auto checked = false;
+  if (options.add_defaults && schema.has(Node::PROPERTIES)) {
+    AddDefaults(instance, schema, context);
+  }
+}
 
-    const Json::Value &child = instance[name];
-    auto child_path = path_add(path, name);
+void SchemaValidator::ValidateMembers(const Json::Value &instance, const Node &schema,
+const Path& path, const ExpansionOptions &options, ValidationContext *context) const {
+  for (auto it = instance.begin(); it != instance.end() && !context->stopped(); ++it) {
+    auto checked = false;
 
-    if (property_names != NULL) {
-      auto name_value = Json::Value(name);
-      Validate(name_value, *property_names, child_path, ExpansionOptions(), context);
+    const Json::Value &child = *it;
+    const char *name_end;
+    auto name = it.memberName(&name_end);
+    auto name_length = static_cast<size_t>(name_end - name);
+    Path child_path(path, name, name_length);
+
+    if (schema.has(Node::PROPERTY_NAMES)) {
+      auto name_value = Json::Value(name, name_end);
+      context->temporaries++;
+      Apply(name_value, schema.property_names, child_path, ExpansionOptions(), context);
+      context->temporaries--;
     }
 
-    if (properties && properties->isMember(name)) {
-      Validate(child, (*properties)[name], child_path, options, context);
-      checked = true;
+    if (schema.has(Node::PROPERTIES)) {
+      auto property = find_property(schema.properties, name, name_end);
+      if (property != NULL) {
+        Apply(child, property->schema, child_path, options, context);
+        checked = true;
+      }
     }
 
-    for (auto pair : pattern_properties) {
-      if (pair.first.PartialMatch(name)) {
-        Validate(child, *(pair.second), child_path, options, context);
-        checked = true;
+    if (schema.has(Node::PATTERN_PROPERTIES)) {
+      for (auto i = schema.pattern_properties.begin; i < schema.pattern_properties.end; i++) {
+        const Property &property = compiled_->properties[i];
+        if (compiled_->regexes[property.regex]->search(name, name_length)) {
+          Apply(child, property.schema, child_path, options, context);
+          checked = true;
+        }
       }
     }
 
-    if (!checked && additional_properties != NULL) {
-      if (additional_properties->isBool() && additional_properties->asBool() == false) {
-        context->add_error(Error(child_path, kUnexpectedProperty));
+    if (!checked && schema.has(Node::ADDITIONAL_PROPERTIES)) {
+      if (compiled_->nodes[schema.additional_properties].has(Node::FALSE_SCHEMA)) {
+        context->add_error([&] { return Error(child_path.str(), kUnexpectedProperty); });
       }
       else {
-        Validate(child, *additional_properties, child_path, options, context);
+        Apply(child, schema.additional_properties, child_path, options, context);
       }
     }
 
-    if (dependencies != NULL && dependencies->isMember(name)) {
-      const Json::Value &dependency = (*dependencies)[name];
-      if (dependency.isArray()) {
-        for (auto dependency_name : dependency) {
-          if (!instance.isMember(dependency_name.asString())) {
-            context->add_error(Error(path, FormatErrorMessage(kObjectPropertyIsRequired, dependency_name.asString())));
+    if (schema.has(Node::DEPENDENCIES)) {
+      auto dependency = find_dependency(schema.dependencies, name, name_end);
+      if (dependency != NULL) {
+        if (dependency->schema == kNoNode) {
+          for (auto i = dependency->required.begin; i < dependency->required.end; i++) {
+            const StringRef &dependency_name = compiled_->names[i];
+            const char *dependency_name_begin = compiled_->chars(dependency_name);
+            if (instance.find(dependency_name_begin, dependency_name_begin + dependency_name.length) == NULL) {
+              context->add_error([&] { return Error(path.str(), FormatErrorMessage(kObjectPropertyIsRequired, compiled_->string(dependency_name))); });
+            }
           }
         }
-      }
-      else {
-        Validate(instance, dependency, path, ExpansionOptions(), context);
+        else {
+          Apply(instance, dependency->schema, path, ExpansionOptions(), context);
+        }
       }
     }
   }
-  
-  if (options.add_defaults && properties != NULL) {
-    for (auto name : properties->getMemberNames()) {
-      if (!instance.isMember(name)) {
-        const Json::Value *property = &(*properties)[name];
-        
-        if (!property->isObject()) {
-          continue;
-        }
+}
 
-        if (property->isMember("$ref")) {
-          property = resolve_ref(property);
-          if (property == NULL) {
-            continue;
-          }
-        }
-        
-        if (property->isMember("default")) {
-          context->add_value(instance, name, (*property)["default"]);
+void SchemaValidator::AddDefaults(const Json::Value &instance, const Node &schema, ValidationContext *context) const {
+  for (auto i = schema.properties.begin; i < schema.properties.end; i++) {
+    const Property &property = compiled_->properties[i];
+    const char *name_begin = compiled_->chars(property.name);
+
+    if (instance.find(name_begin, name_begin + property.name.length) == NULL) {
+      const Node *node = &compiled_->nodes[property.schema];
+
+      if (node->has(Node::REF)) {
+        if (node->ref == kNoNode) {
+          continue;
         }
+        node = &compiled_->nodes[node->ref];
+      }
+      
+      if (node->has(Node::DEFAULT)) {
+        context->add_value(instance, compiled_->string(property.name), compiled_->values[node->default_value]);
       }
     }
   }
 }
 
-void SchemaValidator::ValidateArray(const Json::Value &instance, const Json::Value &schema,
-const std::string& path, const ExpansionOptions &options, ValidationContext *context) const {
+void SchemaValidator::ValidateArray(const Json::Value &instance, const Node &schema,
+const Path& path, const ExpansionOptions &options, ValidationContext *context) const {
   Json::ArrayIndex instance_size = instance.size();
 
-  if (schema.isMember("minItems")) {
-    int min_items = schema["minItems"].asInt();
-
-    if (instance_size < static_cast<size_t>(min_items)) {
-      context->add_error(Error(path, FormatErrorMessage(kArrayMinItems, IntToString(min_items))));
+  if (schema.has(Node::MIN_ITEMS)) {
+    if (instance_size < static_cast<size_t>(schema.min_items)) {
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kArrayMinItems, IntToString(schema.min_items))); });
     }
   }
 
-  if (schema.isMember("maxItems")) {
-    int max_items = schema["maxItems"].asInt();
-    if (instance_size > static_cast<size_t>(max_items)) {
-      context->add_error(Error(path, FormatErrorMessage(kArrayMaxItems, IntToString(max_items))));
+  if (schema.has(Node::MAX_ITEMS)) {
+    if (instance_size > static_cast<size_t>(schema.max_items)) {
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kArrayMaxItems, IntToString(schema.max_items))); });
     }
   }
   
-  Json::ArrayIndex items_size = std::numeric_limits<Json::ArrayIndex>::max();
-  
-  if (schema.isMember("items")) {
-    const Json::Value &items = schema["items"];
+  if (schema.has(Node::ITEMS_TUPLE)) {
+    Json::ArrayIndex items_size = schema.items_tuple.size();
 
-    if (items.isArray()) {
-      items_size = items.size();
-      for (Json::ArrayIndex i = 0; i < items_size && i < instance_size; ++i) {
-        Validate(instance[i], items[i], path_add(path, i), options, context);
-      }
-    }
-    else {
-      // If the items property is a single schema, each item in the array must
-      // validate against that schema.
-      for (Json::ArrayIndex i = 0; i < instance_size; ++i) {
-        Validate(instance[i], items, path_add(path, i), options, context);
-      }
-      return;
+    for (Json::ArrayIndex i = 0; i < items_size && i < instance_size && !context->stopped(); ++i) {
+      Apply(instance[i], compiled_->node_lists[schema.items_tuple.begin + i], Path(path, i), options, context);
     }
 
     if (instance_size > items_size) {
-      if (schema.isMember("additionalItems")) {
-        const Json::Value &additional = schema["additionalItems"];
-      
-        if (additional.isBool()) {
-          if (!additional.asBool()) {
-            context->add_error(Error(path, kNoAdditionalItems));
-          }
+      if (schema.has(Node::ADDITIONAL_ITEMS)) {
+        if (compiled_->nodes[schema.additional_items].has(Node::FALSE_SCHEMA)) {
+          context->add_error([&] { return Error(path.str(), kNoAdditionalItems); });
         }
         else {
-          for (Json::ArrayIndex i = items_size; i < instance_size; ++i) {
-            Validate(instance[i], additional, path_add(path, i), options, context);
+          for (Json::ArrayIndex i = items_size; i < instance_size && !context->stopped(); ++i) {
+            Apply(instance[i], schema.additional_items, Path(path, i), options, context);
           }
         }
       }
     }
   }
+  else if (schema.has(Node::ITEMS)) {
+    // If the items property is a single schema, each item in the array must
+    // validate against that schema.
+    for (Json::ArrayIndex i = 0; i < instance_size && !context->stopped(); ++i) {
+      Apply(instance[i], schema.items, Path(path, i), options, context);
+    }
+  }
+
+  if (context->stopped()) {
+    return;
+  }
+
+  if (schema.has(Node::UNIQUE_ITEMS)) {
+    ValidateUniqueItems(instance, path, context);
+  }
+
+  if (schema.has(Node::CONTAINS)) {
+    ValidateContains(instance, schema, path, context);
+  }
+}
+
+void SchemaValidator::ValidateUniqueItems(const Json::Value &instance, const Path& path, ValidationContext *context) const {
+  Json::ArrayIndex instance_size = instance.size();
+  // About the memory needed for items, hashes and slots below.
+  if (unique_items_memory_limit_ > 0 && instance_size >= kUniqueItemsHashMinimum && static_cast<unsigned long long>(instance_size) * 32 > unique_items_memory_limit_) {
+    ValidateUniqueItemsSpilled(instance, path, context);
+    return;
+  }
+
+  std::vector<const Json::Value *> items;
+  items.reserve(instance_size);
+  for (const Json::Value &item : instance) {
+    items.push_back(&item);
+  }
 
-  if (schema.isMember("uniqueItems") && schema["uniqueItems"].asBool()) {
-    for (Json::ArrayIndex i=0; i<instance.size(); i++) {
-      for (Json::ArrayIndex j=i+1; j<instance.size(); j++) {
-        if (instance[i] == instance[j])
-          context->add_error(Error(path, kArrayItemsNotUnique));
+  // Only the first duplicate is reported: the smallest index equal to an earlier item.
+  if (instance_size < kUniqueItemsHashMinimum) {
+    for (Json::ArrayIndex j = 1; j < instance_size; j++) {
+      for (Json::ArrayIndex i = 0; i < j; i++) {
+        if (values_equal(*items[i], *items[j])) {
+          context->add_error([&] { return Error(path.str(), FormatErrorMessage(kArrayItemsNotUnique, UIntToString(i), UIntToString(j))); });
+          return;
+        }
       }
     }
+    return;
   }
 
-  if (schema.isMember("contains")) {
-    auto ok = false;
-    const Json::Value &contains_schema = schema["contains"];
-
-    for (auto item : instance) {
-      if (isValid(item, contains_schema, ExpansionOptions(), context)) {
-        ok = true;
-        break;
+  Json::ArrayIndex size = 1;
+  while (size < 2 * instance_size) {
+    size *= 2;
+  }
+  std::vector<Json::UInt64> hashes(instance_size);
+  std::vector<Json::ArrayIndex> slots(size, Json::ArrayIndex(kNoValue));
+
+  for (Json::ArrayIndex j = 0; j < instance_size; j++) {
+    auto hash = hashes[j] = hash_value(*items[j]);
+    auto slot = hash & (size - 1);
+    for (; slots[slot] != kNoValue; slot = (slot + 1) & (size - 1)) {
+      auto i = slots[slot];
+      if (hashes[i] == hash && values_equal(*items[i], *items[j])) {
+        context->add_error([&] { return Error(path.str(), FormatErrorMessage(kArrayItemsNotUnique, UIntToString(i), UIntToString(j))); });
+        return;
       }
     }
+    slots[slot] = j;
+  }
+}
 
-    if (!ok) {
-      context->add_error(Error(path, kArrayContains));
+void SchemaValidator::ValidateContains(const Json::Value &instance, const Node &schema,
+const Path& path, ValidationContext *context) const {
+  auto ok = false;
+
+  for (const Json::Value &item : instance) {
+    if (isValid(item, schema.contains, ExpansionOptions(), context)) {
+      ok = true;
+      break;
     }
   }
+
+  if (!ok) {
+    context->add_error([&] { return Error(path.str(), kArrayContains); });
+  }
 }
 
-void SchemaValidator::ValidateString(const Json::Value &instance, const Json::Value &schema,
-const std::string& path, ValidationContext *context) const {
+void SchemaValidator::ValidateString(const Json::Value &instance, const Node &schema,
+const Path& path, ValidationContext *context) const {
   const std::string &value = instance.asString();
 
-  if (schema.isMember("minLength") || schema.isMember("maxLength")) {
-    size_t length = count_utf8_characters(value);
+  if (schema.has(Node::MIN_LENGTH | Node::MAX_LENGTH)) {
+    ValidateLength(value, schema, path, context);
+  }
 
-    if (schema.isMember("minLength")) {
-      int min_length = schema["minLength"].asInt();
-      if (min_length < 0) {
-        context->add_error(Error(path, FormatErrorMessage(kNotNegative, "minLength")));
-        return;
-      }
+  if (schema.has(Node::PATTERN)) {
+    ValidatePattern(value, schema, path, context);
+  }
+}
 
-      if (length < static_cast<size_t>(min_length)) {
-        context->add_error(Error(path, FormatErrorMessage(kStringMinLength, IntToString(min_length))));
-      }
-    }
+void SchemaValidator::ValidateLength(const std::string &value, const Node &schema,
+const Path& path, ValidationContext *context) const {
+  size_t length = count_utf8_characters(value);
 
-    if (schema.isMember("maxLength")) {
-      int max_length = schema["maxLength"].asInt();
-      if (max_length < 0) {
-        context->add_error(Error(path, FormatErrorMessage(kNotNegative, "maxLength")));
-        return;
-      }
+  if (schema.has(Node::MIN_LENGTH)) {
+    if (schema.min_length < 0) {
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kNotNegative, "minLength")); });
+      return;
+    }
 
-      if (length > static_cast<size_t>(max_length)) {
-        context->add_error(Error(path, FormatErrorMessage(kStringMaxLength, IntToString(max_length))));
-      }
+    if (length < static_cast<size_t>(schema.min_length)) {
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kStringMinLength, IntToString(schema.min_length))); });
     }
   }
 
-  if (schema.isMember("pattern")) {
-    std::string pattern = schema["pattern"].asString();
-    if (!pcrecpp::RE(pattern).PartialMatch(instance.asString()))
-      context->add_error(Error(path, FormatErrorMessage(kStringPattern, pattern)));
+  if (schema.has(Node::MAX_LENGTH)) {
+    if (schema.max_length < 0) {
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kNotNegative, "maxLength")); });
+      return;
+    }
+
+    if (length > static_cast<size_t>(schema.max_length)) {
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kStringMaxLength, IntToString(schema.max_length))); });
+    }
   }
 }
 
-void SchemaValidator::ValidateNumber(const Json::Value &instance, const Json::Value &schema,
-const std::string& path, ValidationContext *context) const {
+void SchemaValidator::ValidatePattern(const std::string &value, const Node &schema,
+const Path& path, ValidationContext *context) const {
+  if (!compiled_->regexes[schema.pattern_regex]->search(value))
+    context->add_error([&] { return Error(path.str(), FormatErrorMessage(kStringPattern, compiled_->string(schema.pattern))); });
+}
+
+void SchemaValidator::ValidateNumber(const Json::Value &instance, const Node &schema,
+const Path& path, ValidationContext *context) const {
   double value = instance.asDouble();
 
   // TODO(aa): It would be good to test that the double is not infinity or nan,
   // but isnan and isinf aren't defined on Windows.
 
-  if (schema.isMember("minimum")) {
-    double minimum = schema["minimum"].asDouble();
+  if (schema.has(Node::MINIMUM)) {
+    if (value < schema.minimum) {
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kNumberMinimum, DoubleToString(schema.minimum))); });
+    }
+  }
+
+  if (schema.has(Node::EXCLUSIVE_MINIMUM)) {
+    if (value <= schema.exclusive_minimum) {
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kNumberExclusiveMinimum, DoubleToString(schema.exclusive_minimum))); });
+    }
+  }
+
+  if (schema.has(Node::MAXIMUM)) {
+    if (value > schema.maximum) {
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kNumberMaximum, DoubleToString(schema.maximum))); });
+    }
+  }
+
+  if (schema.has(Node::EXCLUSIVE_MAXIMUM)) {
+    if (value >= schema.exclusive_maximum) {
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kNumberExclusiveMaximum, DoubleToString(schema.exclusive_maximum))); });
+    }
+  }
 
-    if (value < minimum) {
-      context->add_error(Error(path, FormatErrorMessage(kNumberMinimum, DoubleToString(minimum))));
+  if (schema.has(Node::MULTIPLE_OF)) {
+    double divisor = schema.multiple_of;
+    
+    if (divisor != 0. && floor(value/divisor) != (value/divisor)) {
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(
+          kNumberDivisible, DoubleToString(divisor))); });
     }
   }
+}
+
+bool SchemaValidator::ValidateType(unsigned int type, const Node &schema,
+const Path& path, ValidationContext *context) const {
+  if ((schema.types & type) != 0) {
+    return true;
+  }
+
+  if (schema.has(Node::TYPE_CHOICES)) {
+    // TODO: better error message
+    context->add_error([&] { return Error(path.str(), kInvalidChoice); });
+  }
+  else if (schema.type_name.length == 0) {
+    context->add_error([&] { return Error(path.str(), kEmptyType); });
+  }
+  else {
+    context->add_error([&] { return Error(path.str(), FormatErrorMessage(kInvalidType, compiled_->string(schema.type_name), type_bit_name(type))); });
+  }
+  return false;
+}
+
+
+const SchemaValidator::Property *SchemaValidator::find_property(const Range &range, const char *name, const char *name_end) const {
+  size_t name_length = static_cast<size_t>(name_end - name);
+  auto begin = compiled_->properties.begin() + range.begin;
+  auto end = compiled_->properties.begin() + range.end;
+
+  auto it = std::lower_bound(begin, end, name, [this, name_length](const Property &property, const char *key) {
+    return compare_names(compiled_->chars(property.name), property.name.length, key, name_length) < 0;
+  });
+  if (it == end || compare_names(compiled_->chars(it->name), it->name.length, name, name_length) != 0) {
+    return NULL;
+  }
+  return &*it;
+}
+
+
+const SchemaValidator::Dependency *SchemaValidator::find_dependency(const Range &range, const char *name, const char *name_end) const {
+  size_t name_length = static_cast<size_t>(name_end - name);
+  auto begin = compiled_->dependencies.begin() + range.begin;
+  auto end = compiled_->dependencies.begin() + range.end;
+
+  auto it = std::lower_bound(begin, end, name, [this, name_length](const Dependency &dependency, const char *key) {
+    return compare_names(compiled_->chars(dependency.name), dependency.name.length, key, name_length) < 0;
+  });
+  if (it == end || compare_names(compiled_->chars(it->name), it->name.length, name, name_length) != 0) {
+    return NULL;
+  }
+  return &*it;
+}
 
-  if (schema.isMember("exclusiveMinimum")) {
-    double minimum = schema["exclusiveMinimum"].asDouble();
 
-    if (value <= minimum) {
-      context->add_error(Error(path, FormatErrorMessage(kNumberExclusiveMinimum, DoubleToString(minimum))));
+// static
+unsigned int SchemaValidator::type_bit(const Json::Value &value) {
+  switch (value.type()) {
+    case Json::nullValue:
+      return TYPE_NULL;
+    case Json::booleanValue:
+      return TYPE_BOOLEAN;
+    case Json::intValue:
+    case Json::uintValue:
+      return TYPE_INTEGER;
+    case Json::realValue: {
+      double double_value = value.asDouble();
+      if (std::abs(double_value) <= kMaxExactInteger && double_value == floor(double_value)) {
+        return TYPE_INTEGER;
+      } else {
+        return TYPE_NUMBER;
+      }
     }
+    case Json::stringValue:
+      return TYPE_STRING;
+    case Json::objectValue:
+      return TYPE_OBJECT;
+    case Json::arrayValue:
+      return TYPE_ARRAY;
+    default:
+      return 0;
   }
+}
 
-  if (schema.isMember("maximum")) {
-    double maximum = schema["maximum"].asDouble();
 
-    if (value > maximum) {
-      context->add_error(Error(path, FormatErrorMessage(kNumberMaximum, DoubleToString(maximum))));
+// static
+bool SchemaValidator::values_equal(const Json::Value &a, const Json::Value &b) {
+  if (a.isNumeric() && b.isNumeric()) {
+    if (a.isInt64() && b.isInt64()) {
+      return a.asInt64() == b.asInt64();
+    }
+    if (a.isUInt64() && b.isUInt64()) {
+      return a.asUInt64() == b.asUInt64();
     }
+    if (a.type() == Json::realValue && b.type() == Json::realValue) {
+      return a.asDouble() == b.asDouble();
+    }
+    // An integer and a real that is not integral or not in the integer's range.
+    return false;
   }
 
-  if (schema.isMember("exclusiveMaximum")) {
-    double maximum = schema["exclusiveMaximum"].asDouble();
+  if (a.type() != b.type()) {
+    return false;
+  }
+
+  switch (a.type()) {
+    case Json::stringValue: {
+      const char *a_begin, *a_end, *b_begin, *b_end;
+      a.getString(&a_begin, &a_end);
+      b.getString(&b_begin, &b_end);
+      return a_end - a_begin == b_end - b_begin && memcmp(a_begin, b_begin, static_cast<size_t>(a_end - a_begin)) == 0;
+    }
+
+    case Json::arrayValue:
+      if (a.size() != b.size()) {
+        return false;
+      }
+      for (Json::ArrayIndex i = 0; i < a.size(); i++) {
+        if (!values_equal(a[i], b[i])) {
+          return false;
+        }
+      }
+      return true;
 
-    if (value >= maximum) {
-      context->add_error(Error(path, FormatErrorMessage(kNumberExclusiveMaximum, DoubleToString(maximum))));
+    case Json::objectValue: {
+      if (a.size() != b.size()) {
+        return false;
+      }
+      // Members are sorted by name.
+      for (auto a_it = a.begin(), b_it = b.begin(); a_it != a.end(); ++a_it, ++b_it) {
+        const char *a_end, *b_end;
+        auto a_name = a_it.memberName(&a_end);
+        auto b_name = b_it.memberName(&b_end);
+        if (compare_names(a_name, static_cast<size_t>(a_end - a_name), b_name, static_cast<size_t>(b_end - b_name)) != 0 || !values_equal(*a_it, *b_it)) {
+          return false;
+        }
+      }
+      return true;
     }
+
+    default:
+      return a == b;
   }
+}
 
-  if (schema.isMember("multipleOf")) {
-    double divisor = schema["multipleOf"].asDouble();
-    
-    if (divisor != 0. && floor(value/divisor) != (value/divisor)) {
-      context->add_error(Error(path, FormatErrorMessage(
-          kNumberDivisible, DoubleToString(divisor))));
+
+static Json::UInt64 hash_combine(Json::UInt64 hash, Json::UInt64 value) {
+  // 64 bit variant of boost::hash_combine
+  return hash ^ (value + 0x9e3779b97f4a7c15ull + (hash << 12) + (hash >> 4));
+}
+
+
+static Json::UInt64 hash_bytes(const char *data, size_t length) {
+  // FNV-1a
+  Json::UInt64 hash = 0xcbf29ce484222325ull;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ static_cast<unsigned char>(data[i])) * 0x100000001b3ull;
+  }
+  return hash;
+}
+
+
+// static
+Json::UInt64 SchemaValidator::hash_words(const Json::UInt64 *words, size_t count) {
+  Json::UInt64 hash = 0;
+  for (size_t i = 0; i < count; i++) {
+    hash = hash_combine(hash, words[i]);
+  }
+  return hash;
+}
+
+
+// static
+Json::UInt64 SchemaValidator::source_hash(const std::string &schema, const std::string &pointer) {
+  return hash_combine(hash_bytes(schema.data(), schema.length()), hash_bytes(pointer.data(), pointer.length()));
+}
+
+
+// static
+Json::UInt64 SchemaValidator::hash_value(const Json::Value &value) {
+  switch (value.type()) {
+    case Json::nullValue:
+      return 1;
+
+    case Json::booleanValue:
+      return value.asBool() ? 2 : 3;
+
+    case Json::intValue:
+    case Json::uintValue:
+    case Json::realValue:
+      // Integral values hash as integers, so 1 and 1.0 collide as values_equal() requires.
+      if (value.isInt64()) {
+        return hash_combine(4, static_cast<Json::UInt64>(value.asInt64()));
+      }
+      else if (value.isUInt64()) {
+        return hash_combine(4, value.asUInt64());
+      }
+      else {
+        double number = value.asDouble();
+        Json::UInt64 bits;
+        memcpy(&bits, &number, sizeof(bits));
+        return hash_combine(5, bits);
+      }
+
+    case Json::stringValue: {
+      const char *begin, *end;
+      value.getString(&begin, &end);
+      return hash_combine(6, hash_bytes(begin, static_cast<size_t>(end - begin)));
+    }
+
+    case Json::arrayValue: {
+      Json::UInt64 hash = 7;
+      for (const Json::Value &item : value) {
+        hash = hash_combine(hash, hash_value(item));
+      }
+      return hash;
+    }
+
+    case Json::objectValue: {
+      Json::UInt64 hash = 8;
+      for (auto it = value.begin(); it != value.end(); ++it) {
+        const char *end;
+        auto name = it.memberName(&end);
+        hash = hash_combine(hash, hash_bytes(name, static_cast<size_t>(end - name)));
+        hash = hash_combine(hash, hash_value(*it));
+      }
+      return hash;
     }
   }
+
+  return 0;
 }
 
-bool SchemaValidator::ValidateType(const Json::Value &instance, const Json::Value& type,
-const std::string& path, ValidationContext *context) const {
-  if (type.isArray())
-    return ValidateChoices(instance, type, path, context);
 
-  std::string simple_type = type.asString();
-  if (simple_type.empty()) {
-      context->add_error(Error(path, kEmptyType));
-      return false;
+// static
+const char *SchemaValidator::type_bit_name(unsigned int type) {
+  switch (type) {
+    case TYPE_NULL:
+      return "null";
+    case TYPE_BOOLEAN:
+      return "boolean";
+    case TYPE_INTEGER:
+      return "integer";
+    case TYPE_NUMBER:
+      return "number";
+    case TYPE_STRING:
+      return "string";
+    case TYPE_ARRAY:
+      return "array";
+    case TYPE_OBJECT:
+      return "object";
+    default:
+      return "";
   }
-  return ValidateSimpleType(instance, simple_type, path, context);
 }
 
-bool SchemaValidator::ValidateSimpleType(const Json::Value &instance, const std::string& expected_type,
-const std::string& path, ValidationContext *context) const {
-  std::string actual_type = GetSchemaType(instance);
-  if (expected_type == actual_type ||
-      (expected_type == "number" && actual_type == "integer")) {
-    return true;
-  } else {
-    context->add_error(Error(path, FormatErrorMessage(
-        kInvalidType, expected_type, actual_type)));
-    return false;
+
+// static
+unsigned int SchemaValidator::type_mask(const std::string &type) {
+  if (type == "null") {
+    return TYPE_NULL;
+  }
+  else if (type == "boolean") {
+    return TYPE_BOOLEAN;
+  }
+  else if (type == "integer") {
+    return TYPE_INTEGER;
+  }
+  else if (type == "number") {
+    return TYPE_INTEGER | TYPE_NUMBER;
+  }
+  else if (type == "string") {
+    return TYPE_STRING;
+  }
+  else if (type == "array") {
+    return TYPE_ARRAY;
   }
+  else if (type == "object") {
+    return TYPE_OBJECT;
+  }
+  return 0;
 }
 
 
@@ -1044,11 +2150,27 @@ const Json::Value *SchemaValidator::resolve_ref(const Json::Value *schema) const
 }
 
 
-std::string SchemaValidator::path_add(const std::string &path, const std::string &element) {
-    if (path.length() != 1) {
-        return path + "/" + element;
+std::string SchemaValidator::Path::str() const {
+  if (parent == NULL) {
+    return "/";
+  }
+
+  std::vector<const Path *> segments;
+  for (auto segment = this; segment->parent != NULL; segment = segment->parent) {
+    segments.push_back(segment);
+  }
+
+  std::string result;
+  for (auto it = segments.rbegin(); it != segments.rend(); ++it) {
+    result += '/';
+    if ((*it)->name != NULL) {
+      result.append((*it)->name, (*it)->length);
+    }
+    else {
+      result += UIntToString((*it)->index);
     }
-    return path + element;
+  }
+  return result;
 }
 
 
@@ -38,6 +38,7 @@
 #include <stdarg.h>
 
 #include <exception>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -51,16 +52,79 @@ namespace Json {
 } // fix auto indent
 #endif
 
+class Regex;
+class ResultCache;
+class SchemaRegistry;
+class SchemaResolver;
+class StreamValidator;
+
 class SchemaValidator {
+ public:
+  // How validation is evaluated.
+  enum Engine {
+    ENGINE_INTERPRETER, // walk the compiled schema nodes
+    ENGINE_BYTECODE     // run the schema nodes lowered to bytecode
+  };
+
     class Options {
     public:
-        Options()  { }
-        Options(const std::string &pointer) : schema_pointer(pointer) { }
+        Options() : engine(ENGINE_INTERPRETER), regex_match_limit(0), regex_depth_limit(0), unique_items_memory_limit(0), max_errors(0), memoize(false), result_cache_size(0), trusted(false) { }
+        Options(const std::string &pointer, Engine engine_ = ENGINE_INTERPRETER) : schema_pointer(pointer), engine(engine_), regex_match_limit(0), regex_depth_limit(0), unique_items_memory_limit(0), max_errors(0), memoize(false), result_cache_size(0), trusted(false) { }
+        Options(Engine engine_) : engine(engine_), regex_match_limit(0), regex_depth_limit(0), unique_items_memory_limit(0), max_errors(0), memoize(false), result_cache_size(0), trusted(false) { }
         
         std::string schema_pointer;
+        Engine engine;
+        // Limits for matching pattern and patternProperties, 0 uses the regex library's default.
+        // A string exceeding a limit does not match.
+        unsigned long regex_match_limit;
+        unsigned long regex_depth_limit;
+        // Maximum bytes of item fingerprints kept in memory when checking uniqueItems of large
+        // arrays, beyond that sorted runs are spilled to files in temporary_directory
+        // (empty uses $TMPDIR or /tmp). 0 keeps everything in memory.
+        unsigned long unique_items_memory_limit;
+        std::string temporary_directory;
+        // Validation stops after this many errors, 0 for no limit. 1 stops at the first error.
+        unsigned long max_errors;
+        // Remember the result of each branch (anyOf, oneOf, not, if, contains) evaluated without
+        // adding defaults, so a sub-schema is evaluated against the same instance only once per
+        // validation. Helps with recursive schemata nesting branches, costs a lookup otherwise.
+        bool memoize;
+        // Remember the results of this many documents, so validating a document seen before
+        // only costs hashing and comparing it. 0 disables the cache. The cache is shared by
+        // copies of the validator and safe to use from multiple threads. Documents larger than
+        // 64 KiB, as text or parsed, are not cached, so the cache holds at most this many times
+        // that size.
+        unsigned long result_cache_size;
+        // Provides the documents of $refs to URIs that are not an $id of the schema.
+        // Without a resolver, such $refs are an error.
+        std::shared_ptr<SchemaResolver> resolver;
+        // Don't check the schema against the meta-schema. Only for schemata known to be valid,
+        // e.g. checked before deployment: an invalid schema may be rejected with a less helpful
+        // error or compiled into a validator that doesn't do what the schema intends.
+        bool trusted;
+    };
+
+    // Time spent in the phases of creating a validator, in nanoseconds.
+    struct ConstructionTiming {
+        ConstructionTiming() : parse_ns(0), meta_validation_ns(0), collection_ns(0), resolution_ns(0), compile_ns(0) { }
+
+        double parse_ns;           // parsing the schema text
+        double meta_validation_ns; // checking the schema and $ref targets against the meta-schema
+        double collection_ns;      // collecting $ids and $refs
+        double resolution_ns;      // flattening chains of $refs
+        double compile_ns;         // compiling (and lowering to bytecode)
+    };
+
+    // Counters of the result cache.
+    struct CacheStatistics {
+        CacheStatistics() : hits(0), misses(0), evictions(0), entries(0) { }
+
+        unsigned long hits;
+        unsigned long misses;
+        unsigned long evictions;
+        unsigned long entries;
     };
     
- public:
   class ExpansionOptions {
   public:
       ExpansionOptions(bool add_defaults_ = false) : add_defaults(add_defaults_) { }
@@ -113,6 +177,7 @@ class SchemaValidator {
   static const char kArrayMinItems[];
   static const char kArrayMaxItems[];
   static const char kArrayItemsNotUnique[];
+  static const char kUniqueItemsSpillFailed[];
   static const char kArrayItemRequired[];
   static const char kStringMinLength[];
   static const char kStringMaxLength[];
@@ -162,6 +227,12 @@ class SchemaValidator {
   /// with untrusted schemas.
   explicit SchemaValidator(std::string schema_str, const Options &options = Options());
 
+  /// Creates a validator for the schema |uri| refers to in |registry|, sharing
+  /// the registry's compiled documents. |uri| is an $id, optionally with a JSON
+  /// pointer as fragment. The regular expression limits of |options| are ignored,
+  /// the registry's apply.
+  SchemaValidator(const SchemaRegistry &registry, const std::string &uri, const Options &options = Options());
+
   ~SchemaValidator();
 
   /// Returns any errors from the last call to to Validate().
@@ -186,13 +257,55 @@ class SchemaValidator {
   /// This variant is thread save: one validator can run multiple validations simultaneously.
   bool validate(const Json::Value &instance, std::vector<Error> *errors) const;
 
+  /// Returns true if the instance is valid, false otherwise. No errors are
+  /// recorded and validation stops at the first failing keyword.
+  /// This variant is thread save: one validator can run multiple validations simultaneously.
+  bool is_valid(const Json::Value &instance) const;
+
   /// Validates a JSON value and expand according to options.
   ///  Returns true if the instance is valid, false otherwise.
   ///  If false is returned any errors are returned in errors.
   /// This variant is thread save: one validator can run multiple validations simultaneously.
   bool validate_and_expand(Json::Value &instance, const ExpansionOptions &options, std::vector<Error> *errors) const;
 
+  /// Parses and validates a JSON document given as text. If the text can't be parsed,
+  /// false is returned with one error per parser message. With a result cache, a
+  /// document whose text was seen before is not parsed again.
+  /// This variant is thread save: one validator can run multiple validations simultaneously.
+  bool validate_document(const std::string &document, std::vector<Error> *errors) const;
+
+  /// Returns the counters of the result cache, all 0 if there is none.
+  CacheStatistics cache_statistics() const;
+
+  /// Returns the time spent creating the validator, all 0 for validators created from
+  /// a SchemaRegistry or compiled words.
+  const ConstructionTiming &construction_timing() const { return construction_timing_; }
+
+  /// Appends the compiled schema to |words|, in a platform independent format.
+  void serialize(std::vector<Json::UInt64> *words) const;
+
+  /// Writes the compiled schema to |filename| in a platform independent format, with
+  /// |source_hash| identifying what it was compiled from. Throws Exception if the file
+  /// can't be written.
+  void save(const std::string &filename, Json::UInt64 source_hash = 0) const;
+
+  /// Loads a validator saved by save(), mapping the file into memory. No JSON is parsed, the
+  /// schema is not checked against the meta-schema and $refs are not resolved again, but the
+  /// tables, values and regular expressions are still rebuilt from the file, so loading takes
+  /// time linear in the size of the compiled schema. Indices are checked to be in range; the
+  /// hash of the contents only detects corruption, files must come from a trusted source.
+  /// Returns NULL if the file can't be opened or was saved with a different |source_hash|,
+  /// throws Exception if it is not a valid compiled schema.
+  static SchemaValidator *load_file(const std::string &filename, Json::UInt64 source_hash = 0, const Options &options = Options());
+
+  /// Hash of a schema text and schema pointer, to detect outdated files written by save().
+  static Json::UInt64 source_hash(const std::string &schema, const std::string &pointer);
+
  private:
+    friend class SchemaRegistry;
+    friend class SchemaResolver;
+    friend class StreamValidator;
+
     struct AddValue {
         const Json::Value *parent;
         std::string name;
@@ -202,41 +315,390 @@ class SchemaValidator {
         AddValue(const Json::Value *parent_, const std::string &name_, const Json::Value *value_) : parent(parent_), name(name_), value(value_) { }
     };
     
+    // Location of the instance being validated. Each segment lives on the stack of the
+    // call validating the child, the string is only built when an error is recorded.
+    struct Path {
+        const Path *parent;
+        const char *name; // member name, NULL for array items and the root
+        size_t length;
+        Json::ArrayIndex index;
+
+        Path() : parent(NULL), name(NULL), length(0), index(0) { }
+        Path(const Path &parent_, const char *name_, size_t length_) : parent(&parent_), name(name_), length(length_), index(0) { }
+        Path(const Path &parent_, Json::ArrayIndex index_) : parent(&parent_), name(NULL), length(0), index(index_) { }
+
+        std::string str() const;
+    };
+
+    // Key of ValidationContext::memo.
+    struct MemoKey {
+        const Json::Value *instance;
+        Json::UInt node;
+
+        MemoKey(const Json::Value *instance_, Json::UInt node_) : instance(instance_), node(node_) { }
+        bool operator==(const MemoKey &other) const { return instance == other.instance && node == other.node; }
+    };
+    struct MemoKeyHash {
+        size_t operator()(const MemoKey &key) const { return std::hash<const void *>()(key.instance) ^ (static_cast<size_t>(key.node) * 0x9e3779b97f4a7c15ull); }
+    };
+
     struct ValidationContext {
-        std::vector<Error> *errors;
+        std::vector<Error> *errors; // NULL if only the result is needed
         std::vector<AddValue> add_values;
-        
-        ValidationContext(std::vector<Error> *errors_) : errors(errors_) {
-            errors->clear();
+        size_t failures;
+        // Failures before entering the innermost branch whose errors are discarded
+        // (anyOf, oneOf, not, if, contains), kNotInBranch outside of one.
+        size_t branch_failures;
+        // Validation stops when failures reaches this.
+        size_t max_failures;
+
+        static const size_t kNotInBranch = static_cast<size_t>(-1);
+
+        // Results of branches, if memoizing.
+        bool memoize;
+        std::unordered_map<MemoKey, bool, MemoKeyHash> memo;
+        // Non-zero while validating temporary values (property names), whose addresses are reused.
+        unsigned int temporaries;
+
+        ValidationContext(std::vector<Error> *errors_, unsigned long max_errors = 0, bool memoize_ = false) : errors(errors_), failures(0), branch_failures(errors_ == NULL ? 0 : kNotInBranch), max_failures(max_errors > 0 ? static_cast<size_t>(max_errors) : kNotInBranch), memoize(memoize_), temporaries(0) {
+            if (errors != NULL) {
+                errors->clear();
+            }
         }
         
-        void add_error(const Error &error) {
-            errors->push_back(error);
+        // Records a failure. The error is only built if it is kept.
+        template <typename MakeError>
+        void add_error(MakeError make_error) {
+            if (branch_failures == kNotInBranch && failures < max_failures) {
+                errors->push_back(make_error());
+            }
+            failures++;
         }
         
         void add_value(const Json::Value &parent, const std::string &name, const Json::Value &value) {
             add_values.push_back(AddValue(&parent, name, &value));
         }
         
-        size_t get_error_size() const { return errors->size(); }
-        void truncate_errors(size_t size) { errors->resize(size); }
+        // Whether the result of the innermost branch, or of validation without errors, is known,
+        // or the error limit is reached, so the remaining keywords can be skipped.
+        bool stopped() const { return failures > branch_failures || failures >= max_failures; }
+
+        // Returns state to pass to end_branch().
+        size_t begin_branch() {
+            auto saved = branch_failures;
+            branch_failures = failures;
+            return saved;
+        }
+        // Returns whether the branch was valid and discards its failures.
+        bool end_branch(size_t saved) {
+            auto valid = failures == branch_failures;
+            failures = branch_failures;
+            branch_failures = saved;
+            return valid;
+        }
+
+        // Returns the remembered result of |node| for |instance| in |result|.
+        bool find_memo(const Json::Value &instance, Json::UInt node, bool *result) const {
+            if (!memoize || temporaries > 0) {
+                return false;
+            }
+            auto it = memo.find(MemoKey(&instance, node));
+            if (it == memo.end()) {
+                return false;
+            }
+            *result = it->second;
+            return true;
+        }
+        void add_memo(const Json::Value &instance, Json::UInt node, bool result) {
+            // Once the error limit is reached, branches stop early and their result is unreliable.
+            if (memoize && temporaries == 0 && failures < max_failures) {
+                memo[MemoKey(&instance, node)] = result;
+            }
+        }
 
         size_t get_add_values_size() const { return add_values.size(); }
         void truncate_add_values(size_t size) { add_values.resize(size); }
         
-        bool is_valid() const { return errors->empty(); }
+        bool is_valid() const { return failures == 0; }
     };
     
     static const std::string meta_schema;
-    static Json::Value meta_schema_root;
-    static SchemaValidator *meta_validator;
-    
+    // meta_schema compiled by compile-meta-schema, see serialize().
+    static const Json::UInt64 meta_schema_compiled[];
+    static const size_t meta_schema_compiled_size;
+    // Parsed meta_schema, created on first use.
+    static const Json::Value &meta_schema_root();
+    static Json::Value parse_meta_schema();
+    // Validator for meta_schema, created on first use. Safe to use from multiple threads.
+    static const SchemaValidator &meta_validator();
+
+    static std::vector<Error> prefix_errors(const std::string &prefix, const std::vector<Error> &errors);
+
   typedef std::map<std::string, const Json::Value *> SchemaMap;
-    
+
+  typedef Json::UInt NodeIndex;
+  static const NodeIndex kNoNode = 0xffffffff;
+  static const Json::UInt kNoRegex = 0xffffffff;
+  static const Json::UInt kNoValue = 0xffffffff;
+
+  // Primitive types as bits, so a "type" keyword compiles to a mask.
+  enum TypeBit {
+    TYPE_NULL = 1 << 0,
+    TYPE_BOOLEAN = 1 << 1,
+    TYPE_INTEGER = 1 << 2,
+    TYPE_NUMBER = 1 << 3, // non-integral numbers only, "number" is TYPE_INTEGER | TYPE_NUMBER
+    TYPE_STRING = 1 << 4,
+    TYPE_ARRAY = 1 << 5,
+    TYPE_OBJECT = 1 << 6
+  };
+
+  // Half open range [begin, end) into one of the tables of CompiledSchema.
+  struct Range {
+    Json::UInt begin;
+    Json::UInt end;
+
+    Range() : begin(0), end(0) { }
+    Range(Json::UInt begin_, Json::UInt end_) : begin(begin_), end(end_) { }
+    Json::UInt size() const { return end - begin; }
+  };
+
+  // Location of a string in CompiledSchema::strings.
+  struct StringRef {
+    Json::UInt offset;
+    Json::UInt length;
+
+    StringRef() : offset(0), length(0) { }
+    StringRef(Json::UInt offset_, Json::UInt length_) : offset(offset_), length(length_) { }
+  };
+
+  // Entry of properties or patternProperties, sorted by name.
+  // For patternProperties, regex is the index of the compiled pattern.
+  struct Property {
+    Property() : schema(kNoNode), regex(kNoRegex) { }
+
+    StringRef name;
+    NodeIndex schema;
+    Json::UInt regex;
+  };
+
+  // Entry of dependencies, sorted by name. Either schema is set or required lists the dependent property names.
+  struct Dependency {
+    StringRef name;
+    NodeIndex schema;
+    Range required;
+  };
+
+  // Precondition of an anyOf or oneOf branch, a branch failing it can't be valid.
+  struct Branch {
+    Branch() : types(0xffffffff) { }
+
+    // Types of instances the branch can accept.
+    unsigned int types;
+    // For objects, the values allowed for the node's discriminator member, which the branch
+    // requires. Empty if the branch doesn't constrain the discriminator.
+    Range discriminator_values;
+  };
+
+  // The discriminator member of an instance.
+  struct Discriminator {
+    Discriminator() : check(false), value(NULL), hash(0) { }
+
+    bool check; // false if the instance is not an object or there is no discriminator
+    const Json::Value *value; // NULL if the member is missing
+    Json::UInt64 hash;
+  };
+
+  // One schema node with all keywords decoded. Sub-schemata are referenced by index into CompiledSchema::nodes.
+  struct Node {
+    enum Keyword : Json::UInt64 {
+      FALSE_SCHEMA = 1ull << 0,
+      REF = 1ull << 1,
+      TYPE = 1ull << 2,
+      TYPE_CHOICES = 1ull << 3,
+      ALL_OF = 1ull << 4,
+      ANY_OF = 1ull << 5,
+      ONE_OF = 1ull << 6,
+      NOT = 1ull << 7,
+      IF = 1ull << 8,
+      CONST = 1ull << 9,
+      ENUM = 1ull << 10,
+      DEFAULT = 1ull << 11,
+      ANY_OF_DISCRIMINATOR = 1ull << 12,
+      ONE_OF_DISCRIMINATOR = 1ull << 13,
+
+      REQUIRED = 1ull << 16,
+      MIN_PROPERTIES = 1ull << 17,
+      MAX_PROPERTIES = 1ull << 18,
+      PROPERTIES = 1ull << 19,
+      PATTERN_PROPERTIES = 1ull << 20,
+      ADDITIONAL_PROPERTIES = 1ull << 21,
+      PROPERTY_NAMES = 1ull << 22,
+      DEPENDENCIES = 1ull << 23,
+
+      MIN_ITEMS = 1ull << 32,
+      MAX_ITEMS = 1ull << 33,
+      ITEMS = 1ull << 34,
+      ITEMS_TUPLE = 1ull << 35,
+      ADDITIONAL_ITEMS = 1ull << 36,
+      UNIQUE_ITEMS = 1ull << 37,
+      CONTAINS = 1ull << 38,
+
+      MIN_LENGTH = 1ull << 40,
+      MAX_LENGTH = 1ull << 41,
+      PATTERN = 1ull << 42,
+
+      MINIMUM = 1ull << 48,
+      EXCLUSIVE_MINIMUM = 1ull << 49,
+      MAXIMUM = 1ull << 50,
+      EXCLUSIVE_MAXIMUM = 1ull << 51,
+      MULTIPLE_OF = 1ull << 52,
+
+      OBJECT_KEYWORDS = 0xffull << 16,
+      ARRAY_KEYWORDS = 0xffull << 32,
+      STRING_KEYWORDS = 0xffull << 40,
+      NUMBER_KEYWORDS = 0xffull << 48
+    };
+
+    Node();
+
+    bool has(Json::UInt64 keyword) const { return (keywords & keyword) != 0; }
+
+    Json::UInt64 keywords;
+
+    NodeIndex ref;
+    StringRef ref_name;
+
+    unsigned int types;
+    StringRef type_name;
+
+    Range all_of;
+    Range any_of;
+    Range one_of;
+    // Member whose value selects the candidate anyOf/oneOf branches, see Branch.
+    StringRef any_of_discriminator;
+    StringRef one_of_discriminator;
+    NodeIndex not_schema;
+    NodeIndex if_schema;
+    NodeIndex then_schema;
+    NodeIndex else_schema;
+
+    Json::UInt const_value;
+    Range enum_values;
+    Range enum_slots;
+    Json::UInt default_value;
+
+    Range required;
+    Json::UInt64 min_properties;
+    Json::UInt64 max_properties;
+    Range properties;
+    Range pattern_properties;
+    NodeIndex additional_properties;
+    NodeIndex property_names;
+    Range dependencies;
+
+    Json::Int64 min_items;
+    Json::Int64 max_items;
+    NodeIndex items;
+    Range items_tuple;
+    NodeIndex additional_items;
+    NodeIndex contains;
+
+    Json::Int64 min_length;
+    Json::Int64 max_length;
+    StringRef pattern;
+    Json::UInt pattern_regex;
+
+    double minimum;
+    double exclusive_minimum;
+    double maximum;
+    double exclusive_maximum;
+    double multiple_of;
+  };
+
+  // Flat representation of the schema, built once by init(). Validation only uses these tables.
+  struct CompiledSchema {
+    CompiledSchema() : root(kNoNode) { }
+
+    std::string string(const StringRef &ref) const { return strings.substr(ref.offset, ref.length); }
+    const char *chars(const StringRef &ref) const { return strings.data() + ref.offset; }
+
+    std::vector<Node> nodes;
+    std::vector<NodeIndex> node_lists;
+    // Parallel to node_lists, only computed for anyOf and oneOf.
+    std::vector<Branch> branches;
+    std::vector<Property> properties;
+    std::vector<Dependency> dependencies;
+    std::vector<StringRef> names;
+    std::vector<Json::Value> values;
+    // hash_value() of each entry of values.
+    std::vector<Json::UInt64> value_hashes;
+    // Open addressing hash tables of enum values, each a power of two in size. Entries are
+    // indices into values, or kNoValue for empty slots.
+    std::vector<Json::UInt> enum_slots;
+    std::string strings;
+    // Compiled regular expressions, shared read-only by all validating threads.
+    std::vector<std::shared_ptr<const Regex> > regexes;
+
+    NodeIndex root;
+  };
+
+  // Instruction of the bytecode engine, opcodes are defined in bytecode.cc.
+  struct Instruction {
+    Json::UInt opcode;
+    NodeIndex node;
+    Json::UInt arg;
+  };
+
+  // Schema nodes lowered to bytecode. blocks holds the start of each node's code.
+  struct Program {
+    std::vector<Instruction> code;
+    std::vector<Json::UInt> blocks;
+  };
+
   explicit SchemaValidator(Json::Value schema, const Options &options, bool validate_schema);
+  // Empty validator, used by SchemaRegistry to compile documents.
+  explicit SchemaValidator(const Options &options);
+  // Loads a schema compiled by serialize().
+  SchemaValidator(const Json::UInt64 *words, size_t count, const Options &options);
 
+  void set_options(const Options &options);
   void init(const Options &options, bool validate_schema);
 
+  // Serialization of compiled_, implemented in serialize.cc.
+  class Reader;
+  class Writer;
+  void load(const Json::UInt64 *words, size_t count);
+  bool check_compiled() const;
+  static size_t node_words();
+  static void write_node(const Node &node, std::vector<Json::UInt64> *words);
+  static void read_node(Node *node, Reader *reader);
+
+  // Lowers compiled_ into program_.
+  void lower();
+  void lower_node(NodeIndex index);
+  void emit(Json::UInt opcode, NodeIndex node = kNoNode, Json::UInt arg = 0);
+
+  // Compiles |schema| and everything reachable from it into compiled_, returns index of its node.
+  NodeIndex compile(const Json::Value &schema, std::unordered_map<const Json::Value *, NodeIndex> *compiled);
+  NodeIndex compile_root(const Json::Value &schema, std::unordered_map<const Json::Value *, NodeIndex> *compiled);
+  void resolve_refs(bool validate_schema);
+  const Json::Value *find_schema(URI uri) const;
+  Range compile_list(const Json::Value &schemata, std::unordered_map<const Json::Value *, NodeIndex> *compiled);
+  Range compile_properties(const Json::Value &properties, std::unordered_map<const Json::Value *, NodeIndex> *compiled);
+  Range compile_names(const Json::Value &names);
+  StringRef add_string(const std::string &str);
+  Json::UInt add_value(const Json::Value &value);
+  Range compile_enum_slots(const Range &values);
+  Json::UInt add_regex(const std::string &pattern);
+  void compile_pattern_properties(const Range &range);
+  bool compile_branches(const Range &list, StringRef *discriminator);
+  unsigned int accepted_types(NodeIndex index, unsigned int depth) const;
+  bool find_discriminator(NodeIndex index, const StringRef &name, Range *values) const;
+  const Node &follow_refs(NodeIndex index) const;
+
+  Discriminator discriminate(const Json::Value &instance, unsigned int type, bool has_discriminator, const StringRef &name) const;
+  bool is_candidate(const Branch &branch, unsigned int type, const Discriminator &discriminator) const;
+
   // Each of the below methods handle a subset of the validation process. The
   // path paramater is the path to |instance| from the root of the instance tree
   // and is used in error messages.
@@ -244,64 +706,100 @@ class SchemaValidator {
   // Validates any instance node against any schema node. This is called for
   // every node in the instance tree, and it just decides which of the more
   // detailed methods to call.
-  void Validate(const Json::Value &instance, const Json::Value &schema,
-                const std::string& path, const ExpansionOptions &options, ValidationContext *context) const;
+  void Validate(const Json::Value &instance, NodeIndex schema,
+                const Path& path, const ExpansionOptions &options, ValidationContext *context) const;
 
   // Validate, but does not keep errors
-  bool isValid(const Json::Value &instance, const Json::Value &schema, const ExpansionOptions &options, ValidationContext *context) const;
-
-  // Validates a node against a list of possible schemas. If any one of the
-  // schemas match, the node is valid.
-  bool ValidateChoices(const Json::Value &instance, const Json::Value &choices,
-                       const std::string& path, ValidationContext *context) const;
+  bool isValid(const Json::Value &instance, NodeIndex schema, const ExpansionOptions &options, ValidationContext *context) const;
+
+  // Validates |instance| against |schema| using the bytecode engine.
+  void Execute(const Json::Value &instance, NodeIndex schema,
+               const Path& path, const ExpansionOptions &options, ValidationContext *context) const;
+
+  // Validates |instance| against |schema| using the selected engine.
+  void Apply(const Json::Value &instance, NodeIndex schema,
+             const Path& path, const ExpansionOptions &options, ValidationContext *context) const {
+    if (engine_ == ENGINE_BYTECODE) {
+      Execute(instance, schema, path, options, context);
+    }
+    else {
+      Validate(instance, schema, path, options, context);
+    }
+  }
 
   // Validates a node against a list of exact primitive values, eg 42, "foobar".
-  void ValidateEnum(const Json::Value &instance, const Json::Value &choices,
-                    const std::string& path, ValidationContext *context) const;
+  void ValidateEnum(const Json::Value &instance, const Node &schema,
+                    const Path& path, ValidationContext *context) const;
 
   // Validates a JSON object against an object schema node.
-  void ValidateObject(const Json::Value &instance, const Json::Value &schema,
-                      const std::string& path, const ExpansionOptions &options, ValidationContext *context) const;
+  void ValidateObject(const Json::Value &instance, const Node &schema,
+                      const Path& path, const ExpansionOptions &options, ValidationContext *context) const;
+
+  // Validates the members of a JSON object against properties, patternProperties,
+  // additionalProperties, propertyNames and dependencies.
+  void ValidateMembers(const Json::Value &instance, const Node &schema,
+                       const Path& path, const ExpansionOptions &options, ValidationContext *context) const;
+
+  // Records default values of properties missing in |instance|.
+  void AddDefaults(const Json::Value &instance, const Node &schema, ValidationContext *context) const;
 
   // Validates a JSON array against an array schema node.
-  void ValidateArray(const Json::Value &instance, const Json::Value &schema,
-                     const std::string& path, const ExpansionOptions &options, ValidationContext *context) const;
+  void ValidateArray(const Json::Value &instance, const Node &schema,
+                     const Path& path, const ExpansionOptions &options, ValidationContext *context) const;
+
+  void ValidateUniqueItems(const Json::Value &instance, const Path& path, ValidationContext *context) const;
+  // uniqueItems with fingerprints bounded by unique_items_memory_limit_, in unique-items.cc.
+  void ValidateUniqueItemsSpilled(const Json::Value &instance, const Path& path, ValidationContext *context) const;
 
-  // Validates a JSON array against an array schema node configured to be a
-  // tuple. In a tuple, there is one schema node for each item expected in the
-  // array.
-  void ValidateTuple(const Json::Value &instance, const Json::Value &schema,
-                     const std::string& path, ValidationContext *context) const;
+  void ValidateContains(const Json::Value &instance, const Node &schema,
+                        const Path& path, ValidationContext *context) const;
 
   /// Validate a JSON string against a string schema node.
-  void ValidateString(const Json::Value &instance, const Json::Value &schema,
-                      const std::string& path, ValidationContext *context) const;
+  void ValidateString(const Json::Value &instance, const Node &schema,
+                      const Path& path, ValidationContext *context) const;
+
+  void ValidateLength(const std::string &value, const Node &schema,
+                      const Path& path, ValidationContext *context) const;
+
+  void ValidatePattern(const std::string &value, const Node &schema,
+                       const Path& path, ValidationContext *context) const;
 
   /// Validate a JSON number against a number schema node.
-  void ValidateNumber(const Json::Value &instance, const Json::Value &schema,
-                      const std::string& path, ValidationContext *context) const;
+  void ValidateNumber(const Json::Value &instance, const Node &schema,
+                      const Path& path, ValidationContext *context) const;
 
-  /// Validates that the JSON node |instance| conforms to |type|.
-  bool ValidateType(const Json::Value &instance, const Json::Value& type,
-                    const std::string& path, ValidationContext *context) const;
+  /// Validates that a JSON node classified as |type| conforms to the type of |schema|.
+  bool ValidateType(unsigned int type, const Node &schema,
+                    const Path& path, ValidationContext *context) const;
 
-  /// Validates that the JSON node |instance| has |expected_type|.
-  bool ValidateSimpleType(const Json::Value &instance, const std::string& expected_type,
-                          const std::string& path, ValidationContext *context) const;
+  /// Returns the property entry for |name| in |range|, or NULL.
+  const Property *find_property(const Range &range, const char *name, const char *name_end) const;
 
-  /// Returns true if |schema| will allow additional items of any type.
-  bool SchemaAllowsAnyAdditionalItems(
-      const Json::Value &schema, Json::Value* addition_items_schema, const std::string& name) const;
+  /// Returns the dependency entry for |name| in |range|, or NULL.
+  const Dependency *find_dependency(const Range &range, const char *name, const char *name_end) const;
+
+  /// Returns whether |value| is one of the values of |schema|'s enum.
+  bool find_enum(const Node &schema, const Json::Value &value) const;
+
+  // JSON equality, numbers are equal if they are mathematically equal (1 == 1.0).
+  static bool values_equal(const Json::Value &a, const Json::Value &b);
+  // Hash consistent with values_equal.
+  static Json::UInt64 hash_value(const Json::Value &value);
+  static Json::UInt64 hash_words(const Json::UInt64 *words, size_t count);
+
+  static unsigned int type_bit(const Json::Value &value);
+  static unsigned int type_mask(const std::string &type);
+  static const char *type_bit_name(unsigned int type);
 
   void collect_ids_refs(const Json::Value &node, URI base_uri, bool process_refs);
+  // Loads the document |uri| refers to from resolver_ if it is not known yet.
+  void load_remote(URI uri);
 
   const Json::Value *resolve_ref(const Json::Value *schema) const;
-    
-  static std::string path_add(const std::string &path, const std::string &element);
-  static std::string path_add(const std::string &path, Json::UInt64 index) { return path_add(path, UIntToString(index)); }
+
   static size_t count_utf8_characters(const std::string &str);
 
-  static std::string IntToString(int i);
+  static std::string IntToString(Json::Int64 i);
   static std::string UIntToString(Json::UInt64 i);
   static std::string DoubleToString(double d);
 
@@ -316,13 +814,41 @@ class SchemaValidator {
   // The root schema node.
   Json::Value *schema_root_;
 
+  // The compiled schema used for validation, shared by validators created from the same SchemaRegistry.
+  std::shared_ptr<CompiledSchema> compiled_;
+  // Node validated against, compiled_->root unless created from a SchemaRegistry.
+  NodeIndex root_;
+
+  Engine engine_;
+
+  // Only used with ENGINE_BYTECODE.
+  std::shared_ptr<Program> program_;
+
+  unsigned long unique_items_memory_limit_;
+  unsigned long max_errors_;
+  bool memoize_;
+  std::string temporary_directory_;
+  // NULL if Options::result_cache_size is 0.
+  std::shared_ptr<ResultCache> result_cache_;
+  ConstructionTiming construction_timing_;
+  // NULL if Options::resolver is not set.
+  std::shared_ptr<SchemaResolver> resolver_;
+  // Options::trusted, documents from resolver_ are not checked against the meta-schema.
+  bool trusted_;
+
+  // only needed during initialization
   // resolved $refs
   std::unordered_map<const Json::Value *, const Json::Value *> refs;
+  // base URI of $ref targets
+  std::unordered_map<const Json::Value *, URI> ref_bases;
+  // documents loaded by resolver_
+  std::vector<std::shared_ptr<const Json::Value> > remote_documents;
 
-  // only needed during initialization
   // map of $ids
   std::unordered_map<std::string, const Json::Value *> ids;
   std::unordered_set<const Json::Value *> sub_schemata;
+  unsigned long regex_match_limit;
+  unsigned long regex_depth_limit;
 
 
   // Errors accumulated since the last call to Validate().
@@ -0,0 +1,459 @@
+/*
+    StreamValidator.cc -- validate a document given as parser events
+    Copyright 2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <json/StreamValidator.h>
+
+#include <string.h>
+
+#include <json/Regex.h>
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+const Json::UInt64 StreamValidator::kWholeValueKeywords = SchemaValidator::Node::ANY_OF | SchemaValidator::Node::ONE_OF | SchemaValidator::Node::NOT | SchemaValidator::Node::IF | SchemaValidator::Node::CONST | SchemaValidator::Node::ENUM;
+
+StreamValidator::StreamValidator(const SchemaValidator &validator, std::vector<SchemaValidator::Error> *errors) : validator_(validator), compiled_(*validator.compiled_), context_(errors, validator.max_errors_, validator.memoize_), complete_(false) {
+    root_.push_back(validator.root_);
+}
+
+
+StreamValidator::~StreamValidator() {
+}
+
+
+void StreamValidator::start_object() {
+    start(SchemaValidator::TYPE_OBJECT);
+}
+
+
+void StreamValidator::start_array() {
+    start(SchemaValidator::TYPE_ARRAY);
+}
+
+
+void StreamValidator::end_object() {
+    end(SchemaValidator::TYPE_OBJECT);
+}
+
+
+void StreamValidator::end_array() {
+    end(SchemaValidator::TYPE_ARRAY);
+}
+
+
+void StreamValidator::key(const char *name, size_t length) {
+    if (frames_.empty() || frames_.back().type != SchemaValidator::TYPE_OBJECT || frames_.back().has_key) {
+        fail("unexpected member name");
+    }
+
+    Frame &frame = frames_.back();
+    frame.key.assign(name, length);
+    frame.has_key = true;
+    if (!frame.count_names || frame.names.insert(frame.key).second) {
+        frame.size++;
+    }
+    frame.children.clear();
+
+    if (context_.stopped()) {
+        return;
+    }
+
+    name = frame.key.data();
+    auto name_end = name + length;
+    Path path(frame.path, name, length);
+
+    for (auto &evaluation : frame.evaluations) {
+        const SchemaValidator::Node &schema = compiled_.nodes[evaluation.node];
+        auto checked = false;
+
+        for (size_t i = 0; i < evaluation.names_seen.size(); i++) {
+            const auto &required = compiled_.names[evaluation.names_begin + i];
+            if (required.length == length && memcmp(compiled_.chars(required), name, length) == 0) {
+                evaluation.names_seen[i] = true;
+            }
+        }
+
+        if (schema.has(SchemaValidator::Node::PROPERTY_NAMES)) {
+            apply(Json::Value(name, name_end), schema.property_names, path);
+        }
+
+        if (schema.has(SchemaValidator::Node::PROPERTIES)) {
+            auto property = validator_.find_property(schema.properties, name, name_end);
+            if (property != NULL) {
+                frame.children.push_back(property->schema);
+                checked = true;
+            }
+        }
+
+        if (schema.has(SchemaValidator::Node::PATTERN_PROPERTIES)) {
+            for (auto i = schema.pattern_properties.begin; i < schema.pattern_properties.end; i++) {
+                const SchemaValidator::Property &property = compiled_.properties[i];
+                if (compiled_.regexes[property.regex]->search(name, length)) {
+                    frame.children.push_back(property.schema);
+                    checked = true;
+                }
+            }
+        }
+
+        if (!checked && schema.has(SchemaValidator::Node::ADDITIONAL_PROPERTIES)) {
+            if (compiled_.nodes[schema.additional_properties].has(SchemaValidator::Node::FALSE_SCHEMA)) {
+                context_.add_error([&] { return SchemaValidator::Error(path.str(), SchemaValidator::kUnexpectedProperty); });
+            }
+            else {
+                frame.children.push_back(schema.additional_properties);
+            }
+        }
+
+        if (schema.has(SchemaValidator::Node::DEPENDENCIES)) {
+            auto dependency = validator_.find_dependency(schema.dependencies, name, name_end);
+            if (dependency != NULL) {
+                evaluation.dependencies_triggered[static_cast<size_t>(dependency - &compiled_.dependencies[schema.dependencies.begin])] = true;
+            }
+        }
+
+        if (context_.stopped()) {
+            return;
+        }
+    }
+}
+
+
+void StreamValidator::value(const Json::Value &value) {
+    if (value.isObject() || value.isArray()) {
+        fail("objects and arrays must be given as events");
+    }
+
+    Path path;
+    Json::Value *collected;
+    const auto &nodes = next_value(&path, value, &collected);
+
+    for (auto node : nodes) {
+        if (context_.stopped()) {
+            break;
+        }
+        apply(value, node, path);
+    }
+
+    if (frames_.empty()) {
+        complete_ = true;
+    }
+}
+
+
+const std::vector<StreamValidator::NodeIndex> &StreamValidator::next_value(Path *path, const Json::Value &value, Json::Value **collected) {
+    if (complete_) {
+        fail("value after end of document");
+    }
+    if (frames_.empty()) {
+        *path = Path();
+        *collected = NULL;
+        return root_;
+    }
+
+    Frame &frame = frames_.back();
+    if (frame.type == SchemaValidator::TYPE_OBJECT) {
+        if (!frame.has_key) {
+            fail("member without name");
+        }
+        frame.has_key = false;
+        *path = Path(frame.path, frame.key.data(), frame.key.length());
+        *collected = frame.value != NULL ? &((*frame.value)[frame.key] = value) : NULL;
+    }
+    else {
+        *path = Path(frame.path, frame.size);
+        add_items(&frame);
+        frame.size++;
+        *collected = frame.value != NULL ? &frame.value->append(value) : NULL;
+    }
+    return frame.children;
+}
+
+
+void StreamValidator::start(unsigned int type) {
+    Path path;
+    Json::Value *collected;
+    auto empty = Json::Value(type == SchemaValidator::TYPE_OBJECT ? Json::objectValue : Json::arrayValue);
+    const auto &nodes = next_value(&path, empty, &collected);
+
+    // Doesn't invalidate nodes, which belongs to the enclosing frame.
+    frames_.push_back(Frame());
+    Frame &frame = frames_.back();
+    frame.type = type;
+    frame.path = path;
+
+    for (auto node : nodes) {
+        if (context_.stopped()) {
+            break;
+        }
+        expand(node, &frame);
+    }
+    if (type == SchemaValidator::TYPE_OBJECT) {
+        for (const auto &evaluation : frame.evaluations) {
+            if (compiled_.nodes[evaluation.node].has(SchemaValidator::Node::MIN_PROPERTIES | SchemaValidator::Node::MAX_PROPERTIES)) {
+                frame.count_names = true;
+            }
+        }
+    }
+
+    frame.value = collected;
+    if (frame.value == NULL && !frame.deferred.empty()) {
+        frame.buffer.reset(new Json::Value(empty));
+        frame.value = frame.buffer.get();
+    }
+}
+
+
+void StreamValidator::end(unsigned int type) {
+    if (frames_.empty() || frames_.back().type != type || frames_.back().has_key) {
+        fail(type == SchemaValidator::TYPE_OBJECT ? "unexpected end of object" : "unexpected end of array");
+    }
+
+    Frame &frame = frames_.back();
+
+    for (const auto &evaluation : frame.evaluations) {
+        if (context_.stopped()) {
+            break;
+        }
+        const SchemaValidator::Node &schema = compiled_.nodes[evaluation.node];
+
+        if (type == SchemaValidator::TYPE_OBJECT) {
+            auto seen = [&](Json::UInt i) {
+                return i >= evaluation.names_begin && i - evaluation.names_begin < evaluation.names_seen.size() && evaluation.names_seen[i - evaluation.names_begin];
+            };
+
+            if (schema.has(SchemaValidator::Node::REQUIRED)) {
+                for (auto i = schema.required.begin; i < schema.required.end && !context_.stopped(); i++) {
+                    if (!seen(i)) {
+                        context_.add_error([&] { return SchemaValidator::Error(frame.path.str(), SchemaValidator::FormatErrorMessage(SchemaValidator::kObjectPropertyIsRequired, compiled_.string(compiled_.names[i]))); });
+                    }
+                }
+            }
+
+            if (schema.has(SchemaValidator::Node::MIN_PROPERTIES)) {
+                if (frame.size < schema.min_properties) {
+                    context_.add_error([&] { return SchemaValidator::Error(frame.path.str(), SchemaValidator::FormatErrorMessage(SchemaValidator::kObjectMinProperties, SchemaValidator::UIntToString(schema.min_properties))); });
+                }
+            }
+
+            if (schema.has(SchemaValidator::Node::MAX_PROPERTIES)) {
+                if (frame.size > schema.max_properties) {
+                    context_.add_error([&] { return SchemaValidator::Error(frame.path.str(), SchemaValidator::FormatErrorMessage(SchemaValidator::kObjectMaxProperties, SchemaValidator::UIntToString(schema.max_properties))); });
+                }
+            }
+
+            for (size_t d = 0; d < evaluation.dependencies_triggered.size(); d++) {
+                if (!evaluation.dependencies_triggered[d]) {
+                    continue;
+                }
+                const SchemaValidator::Dependency &dependency = compiled_.dependencies[schema.dependencies.begin + d];
+                for (auto i = dependency.required.begin; i < dependency.required.end && !context_.stopped(); i++) {
+                    if (!seen(i)) {
+                        context_.add_error([&] { return SchemaValidator::Error(frame.path.str(), SchemaValidator::FormatErrorMessage(SchemaValidator::kObjectPropertyIsRequired, compiled_.string(compiled_.names[i]))); });
+                    }
+                }
+            }
+        }
+        else {
+            if (schema.has(SchemaValidator::Node::MIN_ITEMS)) {
+                if (frame.size < static_cast<size_t>(schema.min_items)) {
+                    context_.add_error([&] { return SchemaValidator::Error(frame.path.str(), SchemaValidator::FormatErrorMessage(SchemaValidator::kArrayMinItems, SchemaValidator::IntToString(schema.min_items))); });
+                }
+            }
+
+            if (schema.has(SchemaValidator::Node::MAX_ITEMS)) {
+                if (frame.size > static_cast<size_t>(schema.max_items)) {
+                    context_.add_error([&] { return SchemaValidator::Error(frame.path.str(), SchemaValidator::FormatErrorMessage(SchemaValidator::kArrayMaxItems, SchemaValidator::IntToString(schema.max_items))); });
+                }
+            }
+        }
+    }
+
+    for (auto node : frame.deferred) {
+        if (context_.stopped()) {
+            break;
+        }
+        apply(*frame.value, node, frame.path);
+    }
+
+    frames_.pop_back();
+    if (frames_.empty()) {
+        complete_ = true;
+    }
+}
+
+
+// Adds the keywords of node |index| to |frame|: evaluated as members or items arrive,
+// or deferred until the value is complete.
+void StreamValidator::expand(NodeIndex index, Frame *frame) {
+    auto type = frame->type;
+
+    while (true) {
+        const SchemaValidator::Node &schema = compiled_.nodes[index];
+
+        if (schema.has(SchemaValidator::Node::FALSE_SCHEMA)) {
+            context_.add_error([&] { return SchemaValidator::Error(frame->path.str(), SchemaValidator::kFalse); });
+            return;
+        }
+        if (!schema.has(SchemaValidator::Node::REF)) {
+            break;
+        }
+        if (schema.ref == SchemaValidator::kNoNode) {
+            // should not happen
+            context_.add_error([&] { return SchemaValidator::Error(frame->path.str(), SchemaValidator::FormatErrorMessage(SchemaValidator::kUnknownTypeReference, compiled_.string(schema.ref_name))); });
+            return;
+        }
+        index = schema.ref;
+    }
+
+    const SchemaValidator::Node &schema = compiled_.nodes[index];
+
+    auto deferred = schema.has(kWholeValueKeywords);
+    if (type == SchemaValidator::TYPE_ARRAY) {
+        deferred = deferred || schema.has(SchemaValidator::Node::UNIQUE_ITEMS | SchemaValidator::Node::CONTAINS);
+    }
+    else if (schema.has(SchemaValidator::Node::DEPENDENCIES)) {
+        for (auto i = schema.dependencies.begin; i < schema.dependencies.end; i++) {
+            if (compiled_.dependencies[i].schema != SchemaValidator::kNoNode) {
+                deferred = true;
+            }
+        }
+    }
+    if (deferred) {
+        frame->deferred.push_back(index);
+        return;
+    }
+
+    if (schema.has(SchemaValidator::Node::TYPE)) {
+        if (!validator_.ValidateType(type, schema, frame->path, &context_)) {
+            return;
+        }
+    }
+
+    if (schema.has(SchemaValidator::Node::ALL_OF)) {
+        for (auto i = schema.all_of.begin; i < schema.all_of.end; i++) {
+            expand(compiled_.node_lists[i], frame);
+            if (context_.stopped()) {
+                return;
+            }
+        }
+    }
+
+    if (type == SchemaValidator::TYPE_ARRAY) {
+        if (schema.has(SchemaValidator::Node::ARRAY_KEYWORDS)) {
+            frame->evaluations.push_back(Evaluation(index));
+        }
+        return;
+    }
+
+    if (!schema.has(SchemaValidator::Node::OBJECT_KEYWORDS)) {
+        return;
+    }
+
+    Evaluation evaluation(index);
+    // Names whose presence is checked at the end of the object.
+    auto begin = Json::UInt(SchemaValidator::kNoValue);
+    Json::UInt end = 0;
+    auto add_names = [&](const SchemaValidator::Range &range) {
+        if (range.size() > 0) {
+            begin = std::min(begin, range.begin);
+            end = std::max(end, range.end);
+        }
+    };
+    if (schema.has(SchemaValidator::Node::REQUIRED)) {
+        add_names(schema.required);
+    }
+    if (schema.has(SchemaValidator::Node::DEPENDENCIES)) {
+        for (auto i = schema.dependencies.begin; i < schema.dependencies.end; i++) {
+            add_names(compiled_.dependencies[i].required);
+        }
+        evaluation.dependencies_triggered.resize(schema.dependencies.size());
+    }
+    if (begin < end) {
+        evaluation.names_begin = begin;
+        evaluation.names_seen.resize(end - begin);
+    }
+    frame->evaluations.push_back(evaluation);
+}
+
+
+// Sets the children of |frame| to the nodes applying to its next item.
+void StreamValidator::add_items(Frame *frame) {
+    auto index = frame->size;
+    frame->children.clear();
+
+    if (context_.stopped()) {
+        return;
+    }
+
+    for (const auto &evaluation : frame->evaluations) {
+        const SchemaValidator::Node &schema = compiled_.nodes[evaluation.node];
+
+        if (schema.has(SchemaValidator::Node::ITEMS_TUPLE)) {
+            if (index < schema.items_tuple.size()) {
+                frame->children.push_back(compiled_.node_lists[schema.items_tuple.begin + index]);
+            }
+            else if (schema.has(SchemaValidator::Node::ADDITIONAL_ITEMS)) {
+                if (compiled_.nodes[schema.additional_items].has(SchemaValidator::Node::FALSE_SCHEMA)) {
+                    // Reported once, for the first additional item.
+                    if (index == schema.items_tuple.size()) {
+                        context_.add_error([&] { return SchemaValidator::Error(frame->path.str(), SchemaValidator::kNoAdditionalItems); });
+                    }
+                }
+                else {
+                    frame->children.push_back(schema.additional_items);
+                }
+            }
+        }
+        else if (schema.has(SchemaValidator::Node::ITEMS)) {
+            frame->children.push_back(schema.items);
+        }
+    }
+}
+
+
+void StreamValidator::apply(const Json::Value &value, NodeIndex node, const Path &path) {
+    validator_.Apply(value, node, path, SchemaValidator::ExpansionOptions(), &context_);
+    // Memoized results are keyed by address, which is reused once value is gone.
+    context_.memo.clear();
+}
+
+
+void StreamValidator::fail(const std::string &message) {
+    SchemaValidator::Exception e(SchemaValidator::Exception::PARSING);
+    e.errors.push_back(SchemaValidator::Error("", message));
+    throw e;
+}
+
+}
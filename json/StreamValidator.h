@@ -0,0 +1,163 @@
+/*
+    StreamValidator.h -- validate a document given as parser events
+    Copyright 2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef JSON_STREAM_VALIDATOR_H
+#define JSON_STREAM_VALIDATOR_H
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <json/json.h>
+#include <json/SchemaValidator.h>
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+/*
+  Validates one document against the compiled schema of a SchemaValidator
+  while it is being parsed, without building a Json::Value of it. The
+  parser reports the document as events: the start and end of objects and
+  arrays, member names and scalar values.
+
+  Object and array keywords are evaluated as members and items arrive,
+  keeping a frame per open object or array, so memory is proportional to
+  the nesting depth. Schema nodes whose result depends on the value as a
+  whole (anyOf, oneOf, not, if, const, enum, uniqueItems, contains and
+  schema dependencies) are evaluated when their object or array is
+  complete; only that subtree is kept in memory.
+
+  Errors are the same as those of SchemaValidator::validate(), but
+  reported in document order. Default values are not added. Of members
+  with the same name, Json::Reader keeps only the last; minProperties and
+  maxProperties count distinct names like it, but the value of every
+  duplicate is validated.
+*/
+class StreamValidator {
+public:
+    // |validator| must outlive the stream validator. Errors are added to |errors| as they are found;
+    // with NULL, validation stops at the first failure.
+    explicit StreamValidator(const SchemaValidator &validator, std::vector<SchemaValidator::Error> *errors = NULL);
+    ~StreamValidator();
+
+    // Parser events. Throw SchemaValidator::Exception if they don't form a single JSON document.
+    void start_object();
+    void key(const char *name, size_t length);
+    void key(const std::string &name) { key(name.data(), name.length()); }
+    void end_object();
+    void start_array();
+    void end_array();
+    // A null, boolean, number or string.
+    void value(const Json::Value &value);
+
+    // Whether the complete document has been seen.
+    bool complete() const { return complete_; }
+    // Whether no violation of the schema was found so far.
+    bool is_valid() const { return context_.is_valid(); }
+    // Whether the remaining events can't change the result: a violation was found without
+    // keeping errors, or the error limit is reached.
+    bool stopped() const { return context_.stopped(); }
+
+private:
+    typedef SchemaValidator::NodeIndex NodeIndex;
+    typedef SchemaValidator::Path Path;
+
+    // Keywords needing the complete value of an object or array.
+    static const Json::UInt64 kWholeValueKeywords;
+
+    // A schema node evaluated against an object or array as its members or items arrive.
+    struct Evaluation {
+        explicit Evaluation(NodeIndex node_) : node(node_), names_begin(0) { }
+
+        NodeIndex node;
+        // Objects: which of the names in [names_begin, names_begin + names_seen.size()) of
+        // CompiledSchema::names were seen, covering required and dependencies.
+        Json::UInt names_begin;
+        std::vector<bool> names_seen;
+        // Objects: dependencies whose member was seen.
+        std::vector<bool> dependencies_triggered;
+    };
+
+    // An open object or array.
+    struct Frame {
+        Frame() : type(0), size(0), has_key(false), count_names(false), value(NULL) { }
+
+        unsigned int type; // TYPE_OBJECT or TYPE_ARRAY
+        Path path;
+        std::vector<Evaluation> evaluations;
+        // Nodes evaluated by the SchemaValidator once the value is complete.
+        std::vector<NodeIndex> deferred;
+        // Members or items so far, distinct member names if names is used.
+        Json::ArrayIndex size;
+        // Objects: name of the current member.
+        std::string key;
+        bool has_key;
+        // Objects: whether minProperties or maxProperties apply, counting distinct names.
+        bool count_names;
+        std::unordered_set<std::string> names;
+        // Nodes the current member applies to.
+        std::vector<NodeIndex> children;
+        // The value collected for deferred nodes of this or an enclosing frame, NULL if none.
+        Json::Value *value;
+        // Owns value if no enclosing frame collects.
+        std::unique_ptr<Json::Value> buffer;
+    };
+
+    StreamValidator(const StreamValidator &);
+    StreamValidator &operator=(const StreamValidator &);
+
+    // Returns the nodes applying to the next value and its path, adds it to the collected value.
+    const std::vector<NodeIndex> &next_value(Path *path, const Json::Value &value, Json::Value **collected);
+    void start(unsigned int type);
+    void end(unsigned int type);
+    void expand(NodeIndex index, Frame *frame);
+    void add_items(Frame *frame);
+    void apply(const Json::Value &value, NodeIndex node, const Path &path);
+    [[noreturn]] static void fail(const std::string &message);
+
+    const SchemaValidator &validator_;
+    const SchemaValidator::CompiledSchema &compiled_;
+    SchemaValidator::ValidationContext context_;
+    // Never reallocated, paths refer to the path and key of their enclosing frame.
+    std::deque<Frame> frames_;
+    std::vector<NodeIndex> root_;
+    bool complete_;
+};
+
+}
+
+#endif // JSON_STREAM_VALIDATOR_H
@@ -36,7 +36,7 @@
 #include <sstream>
 #include <stdexcept>
 
-#include <pcrecpp.h>
+#include <json/Regex.h>
 
 namespace Json {
 #if 0
@@ -144,19 +144,24 @@ URI URI::resolve(const URI &reference) const {
 
 // RFC 3986, Appendix B. Parsing a URI Reference with a Regular Expression
 void URI::parse() {
-    static pcrecpp::RE regex("^(([^:/?#]+):)?(//([^/?#]*))?([^?#]*)(\\?([^#]*))?(#(.*))?");
+    static const Regex regex("^(([^:/?#]+):)?(//([^/?#]*))?([^?#]*)(\\?([^#]*))?(#(.*))?");
 
-    std::string scheme_sep;
-    std::string authority_sep;
-    std::string query_sep;
-    std::string fragment_sep;
+    std::vector<std::string> groups;
 
-    regex.FullMatch(uri, &scheme_sep, &scheme, &authority_sep, &authority, &path, &query_sep, &query, &fragment_sep, &fragment);
+    if (!regex.match(uri, &groups)) {
+        groups.assign(9, "");
+    }
+
+    scheme = groups[1];
+    authority = groups[3];
+    path = groups[4];
+    query = groups[6];
+    fragment = groups[8];
 
-    scheme_present = !scheme_sep.empty();
-    authority_present = !authority_sep.empty();
-    query_present = !query_sep.empty();
-    fragment_present = !fragment_sep.empty();
+    scheme_present = !groups[0].empty();
+    authority_present = !groups[2].empty();
+    query_present = !groups[5].empty();
+    fragment_present = !groups[7].empty();
 
     needs_update = false;
 
@@ -210,14 +215,14 @@ void URI::update() const {
 
 
 std::string URI::remove_dot_segments(const std::string &path) {
-    static pcrecpp::RE dotdot("(^|/)[^/]*/\\.\\.(/|$)");
-    static pcrecpp::RE dot("(^|/)\\.(/|$)");
-    static pcrecpp::RE leading_dotdot("^/?\\.\\./");
+    static const Regex dotdot("(^|/)[^/]*/\\.\\.(/|$)");
+    static const Regex dot("(^|/)\\.(/|$)");
+    static const Regex leading_dotdot("^/?\\.\\./");
 
     std::string result = path;
-    dot.GlobalReplace("/", &result);
-    leading_dotdot.GlobalReplace("/", &result);
-    dotdot.GlobalReplace("/", &result);
+    dot.replace_all("/", &result);
+    leading_dotdot.replace_all("/", &result);
+    dotdot.replace_all("/", &result);
     return result;
 }
 
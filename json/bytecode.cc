@@ -0,0 +1,704 @@
+/*
+    bytecode.cc -- bytecode engine for SchemaValidator
+    Copyright 2015-2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <json/SchemaValidator.h>
+
+#include <cmath>
+
+/*
+  Each compiled schema node is lowered into a block of instructions
+  containing only the keywords present in that node, so evaluation cost
+  is proportional to the keywords that apply.
+
+  Sub-schemata applied to the same instance ($ref, allOf, anyOf, oneOf,
+  not, if/then/else) run in the same interpreter loop, using an explicit
+  stack of return addresses. Only descending into object members or array
+  items starts a new loop for the child instance.
+
+  Instructions refer to their schema node for keyword values; CALL, TRY
+  and GOTO refer to the node whose block is run, all other jumps are
+  absolute offsets into the code.
+*/
+
+#if defined(__GNUC__)
+#define JSON_SCHEMA_COMPUTED_GOTO
+#endif
+
+#define JSON_SCHEMA_OPCODES(X) \
+  X(RETURN)            /* return to caller, or end evaluation */ \
+  X(FAIL)              /* schema false */ \
+  X(UNRESOLVED_REF) \
+  X(GOTO)              /* continue with block of node ($ref) */ \
+  X(JUMP) \
+  X(TYPE) \
+  X(CALL)              /* run block of node on same instance */ \
+  X(TRY)               /* like CALL, discard errors and set valid */ \
+  X(TRY_STRICT)        /* like TRY, but don't add defaults */ \
+  X(JUMP_IF_INVALID) \
+  X(COUNT_RESET) \
+  X(DISCRIMINATE)      /* look up discriminator of anyOf (arg 0) or oneOf (arg 1) */ \
+  X(CANDIDATE)         /* skip TRY and step of branch arg unless it can match */ \
+  X(ANY_OF_STEP)       /* count valid, jump to ANY_OF_CHECK unless adding defaults */ \
+  X(ANY_OF_CHECK) \
+  X(ONE_OF_STEP)       /* count valid, jump to ONE_OF_CHECK on second match */ \
+  X(ONE_OF_CHECK) \
+  X(NOT_CHECK) \
+  X(CONST) \
+  X(ENUM) \
+  X(OBJECT_SECTION)    /* skip to arg unless instance is object */ \
+  X(REQUIRED) \
+  X(MIN_PROPERTIES) \
+  X(MAX_PROPERTIES) \
+  X(MEMBERS) \
+  X(DEFAULTS) \
+  X(ARRAY_SECTION) \
+  X(MIN_ITEMS) \
+  X(MAX_ITEMS) \
+  X(ITEMS) \
+  X(ITEMS_TUPLE) \
+  X(UNIQUE_ITEMS) \
+  X(CONTAINS) \
+  X(STRING_SECTION) \
+  X(LENGTH) \
+  X(PATTERN) \
+  X(NUMBER_SECTION) \
+  X(MINIMUM) \
+  X(EXCLUSIVE_MINIMUM) \
+  X(MAXIMUM) \
+  X(EXCLUSIVE_MAXIMUM) \
+  X(MULTIPLE_OF)
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+namespace {
+
+#define JSON_SCHEMA_OPCODE_ENUM(name) OP_##name,
+enum Opcode {
+  JSON_SCHEMA_OPCODES(JSON_SCHEMA_OPCODE_ENUM)
+};
+#undef JSON_SCHEMA_OPCODE_ENUM
+
+}
+
+
+void SchemaValidator::lower() {
+  program_ = std::make_shared<Program>();
+  program_->blocks.assign(compiled_->nodes.size(), 0);
+
+  for (NodeIndex index = 0; index < compiled_->nodes.size(); index++) {
+    lower_node(index);
+  }
+}
+
+
+void SchemaValidator::emit(Json::UInt opcode, NodeIndex node, Json::UInt arg) {
+  Instruction instruction;
+
+  instruction.opcode = opcode;
+  instruction.node = node;
+  instruction.arg = arg;
+  program_->code.push_back(instruction);
+}
+
+
+void SchemaValidator::lower_node(NodeIndex index) {
+  const Node &node = compiled_->nodes[index];
+  auto &code = program_->code;
+
+  program_->blocks[index] = static_cast<Json::UInt>(code.size());
+
+  if (node.has(Node::FALSE_SCHEMA)) {
+    emit(OP_FAIL, index);
+    return;
+  }
+
+  if (node.has(Node::REF)) {
+    if (node.ref == kNoNode) {
+      emit(OP_UNRESOLVED_REF, index);
+    }
+    else {
+      emit(OP_GOTO, node.ref);
+    }
+    return;
+  }
+
+  if (node.has(Node::TYPE)) {
+    emit(OP_TYPE, index);
+  }
+
+  if (node.has(Node::ALL_OF)) {
+    for (auto i = node.all_of.begin; i < node.all_of.end; i++) {
+      emit(OP_CALL, compiled_->node_lists[i]);
+    }
+  }
+  if (node.has(Node::ANY_OF)) {
+    std::vector<size_t> steps;
+
+    emit(OP_COUNT_RESET);
+    emit(OP_DISCRIMINATE, index, 0);
+    for (auto i = node.any_of.begin; i < node.any_of.end; i++) {
+      emit(OP_CANDIDATE, index, i);
+      emit(OP_TRY, compiled_->node_lists[i]);
+      steps.push_back(code.size());
+      emit(OP_ANY_OF_STEP);
+    }
+    for (auto step : steps) {
+      code[step].arg = static_cast<Json::UInt>(code.size());
+    }
+    emit(OP_ANY_OF_CHECK);
+  }
+  if (node.has(Node::ONE_OF)) {
+    std::vector<size_t> steps;
+
+    emit(OP_COUNT_RESET);
+    emit(OP_DISCRIMINATE, index, 1);
+    for (auto i = node.one_of.begin; i < node.one_of.end; i++) {
+      emit(OP_CANDIDATE, index, i);
+      emit(OP_TRY, compiled_->node_lists[i]);
+      steps.push_back(code.size());
+      emit(OP_ONE_OF_STEP);
+    }
+    for (auto step : steps) {
+      code[step].arg = static_cast<Json::UInt>(code.size());
+    }
+    emit(OP_ONE_OF_CHECK);
+  }
+  if (node.has(Node::NOT)) {
+    emit(OP_TRY_STRICT, node.not_schema);
+    emit(OP_NOT_CHECK);
+  }
+  if (node.has(Node::IF)) {
+    emit(OP_TRY_STRICT, node.if_schema);
+    auto jump_if_invalid = code.size();
+    emit(OP_JUMP_IF_INVALID);
+    if (node.then_schema != kNoNode) {
+      emit(OP_CALL, node.then_schema);
+    }
+    auto jump = code.size();
+    emit(OP_JUMP);
+    code[jump_if_invalid].arg = static_cast<Json::UInt>(code.size());
+    if (node.else_schema != kNoNode) {
+      emit(OP_CALL, node.else_schema);
+    }
+    code[jump].arg = static_cast<Json::UInt>(code.size());
+  }
+
+  if (node.has(Node::CONST)) {
+    emit(OP_CONST, index);
+  }
+  if (node.has(Node::ENUM)) {
+    // enum ends validation of the node.
+    emit(OP_ENUM, index);
+    emit(OP_RETURN);
+    return;
+  }
+
+  if (node.has(Node::OBJECT_KEYWORDS)) {
+    auto section = code.size();
+    emit(OP_OBJECT_SECTION);
+    if (node.has(Node::REQUIRED)) {
+      emit(OP_REQUIRED, index);
+    }
+    if (node.has(Node::MIN_PROPERTIES)) {
+      emit(OP_MIN_PROPERTIES, index);
+    }
+    if (node.has(Node::MAX_PROPERTIES)) {
+      emit(OP_MAX_PROPERTIES, index);
+    }
+    if (node.has(Node::PROPERTIES | Node::PATTERN_PROPERTIES | Node::ADDITIONAL_PROPERTIES | Node::PROPERTY_NAMES | Node::DEPENDENCIES)) {
+      emit(OP_MEMBERS, index);
+    }
+    if (node.has(Node::PROPERTIES)) {
+      emit(OP_DEFAULTS, index);
+    }
+    emit(OP_RETURN);
+    code[section].arg = static_cast<Json::UInt>(code.size());
+  }
+
+  if (node.has(Node::ARRAY_KEYWORDS)) {
+    auto section = code.size();
+    emit(OP_ARRAY_SECTION);
+    if (node.has(Node::MIN_ITEMS)) {
+      emit(OP_MIN_ITEMS, index);
+    }
+    if (node.has(Node::MAX_ITEMS)) {
+      emit(OP_MAX_ITEMS, index);
+    }
+    if (node.has(Node::ITEMS_TUPLE)) {
+      emit(OP_ITEMS_TUPLE, index);
+    }
+    else if (node.has(Node::ITEMS)) {
+      emit(OP_ITEMS, index);
+    }
+    if (node.has(Node::UNIQUE_ITEMS)) {
+      emit(OP_UNIQUE_ITEMS, index);
+    }
+    if (node.has(Node::CONTAINS)) {
+      emit(OP_CONTAINS, index);
+    }
+    emit(OP_RETURN);
+    code[section].arg = static_cast<Json::UInt>(code.size());
+  }
+
+  if (node.has(Node::STRING_KEYWORDS)) {
+    auto section = code.size();
+    emit(OP_STRING_SECTION);
+    if (node.has(Node::MIN_LENGTH | Node::MAX_LENGTH)) {
+      emit(OP_LENGTH, index);
+    }
+    if (node.has(Node::PATTERN)) {
+      emit(OP_PATTERN, index);
+    }
+    emit(OP_RETURN);
+    code[section].arg = static_cast<Json::UInt>(code.size());
+  }
+
+  if (node.has(Node::NUMBER_KEYWORDS)) {
+    auto section = code.size();
+    emit(OP_NUMBER_SECTION);
+    if (node.has(Node::MINIMUM)) {
+      emit(OP_MINIMUM, index);
+    }
+    if (node.has(Node::EXCLUSIVE_MINIMUM)) {
+      emit(OP_EXCLUSIVE_MINIMUM, index);
+    }
+    if (node.has(Node::MAXIMUM)) {
+      emit(OP_MAXIMUM, index);
+    }
+    if (node.has(Node::EXCLUSIVE_MAXIMUM)) {
+      emit(OP_EXCLUSIVE_MAXIMUM, index);
+    }
+    if (node.has(Node::MULTIPLE_OF)) {
+      emit(OP_MULTIPLE_OF, index);
+    }
+    emit(OP_RETURN);
+    code[section].arg = static_cast<Json::UInt>(code.size());
+  }
+
+  emit(OP_RETURN);
+}
+
+
+void SchemaValidator::Execute(const Json::Value &instance, NodeIndex schema,
+const Path& path, const ExpansionOptions &options, ValidationContext *context) const {
+  // Caller state saved by CALL and TRY.
+  struct Frame {
+    const Instruction *return_pc;
+    size_t saved_branch;
+    size_t add_values_before;
+    bool discard_errors;
+    bool add_defaults;
+    NodeIndex memo_node; // kNoNode unless the result is remembered
+    Json::UInt count;
+    Discriminator discriminator;
+  };
+  static const size_t kMaxFrames = 64;
+
+  Frame stack[kMaxFrames];
+  size_t depth = 0;
+
+  const Instruction *code = program_->code.data();
+  const Instruction *pc = code + program_->blocks[schema];
+  const unsigned int type = type_bit(instance);
+  bool add_defaults = options.add_defaults;
+  // Result of the last TRY.
+  bool valid = true;
+  // Number of valid branches of anyOf or oneOf.
+  Json::UInt count = 0;
+  // Of the anyOf or oneOf being evaluated.
+  Discriminator discriminator;
+  double number = 0;
+
+#define NODE (compiled_->nodes[pc->node])
+
+#ifdef JSON_SCHEMA_COMPUTED_GOTO
+#define JSON_SCHEMA_OPCODE_LABEL(name) &&L_##name,
+  static const void *const dispatch_table[] = {
+    JSON_SCHEMA_OPCODES(JSON_SCHEMA_OPCODE_LABEL)
+  };
+#undef JSON_SCHEMA_OPCODE_LABEL
+#define DISPATCH() goto *dispatch_table[pc->opcode]
+#define CASE(name) L_##name
+  DISPATCH();
+  {
+#else
+#define DISPATCH() goto dispatch
+#define CASE(name) case OP_##name
+ dispatch:
+  switch (pc->opcode) {
+#endif
+
+    CASE(RETURN):
+    do_return: {
+      if (depth == 0) {
+        return;
+      }
+      const Frame &frame = stack[--depth];
+      if (frame.discard_errors) {
+        valid = context->end_branch(frame.saved_branch);
+        if (!valid) {
+          context->truncate_add_values(frame.add_values_before);
+        }
+        if (frame.memo_node != kNoNode) {
+          context->add_memo(instance, frame.memo_node, valid);
+        }
+      }
+      else if (context->stopped()) {
+        // The result of the enclosing branch is known, skip the rest of the caller.
+        goto do_return;
+      }
+      add_defaults = frame.add_defaults;
+      count = frame.count;
+      discriminator = frame.discriminator;
+      pc = frame.return_pc;
+      DISPATCH();
+    }
+
+    CASE(FAIL):
+      context->add_error([&] { return Error(path.str(), kFalse); });
+      goto do_return;
+
+    CASE(UNRESOLVED_REF):
+      // should not happen
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kUnknownTypeReference, compiled_->string(NODE.ref_name))); });
+      goto do_return;
+
+    CASE(GOTO):
+      pc = code + program_->blocks[pc->node];
+      DISPATCH();
+
+    CASE(JUMP):
+      pc = code + pc->arg;
+      DISPATCH();
+
+    CASE(TYPE):
+      if (!ValidateType(type, NODE, path, context)) {
+        goto do_return;
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(CALL):
+    CASE(TRY):
+    CASE(TRY_STRICT): {
+      auto discard_errors = pc->opcode != OP_CALL;
+      auto callee_add_defaults = add_defaults && pc->opcode != OP_TRY_STRICT;
+
+      // With defaults, the branch has side effects.
+      if (discard_errors && !callee_add_defaults && context->find_memo(instance, pc->node, &valid)) {
+        pc++;
+        DISPATCH();
+      }
+
+      if (depth == kMaxFrames) {
+        // Too deeply nested, continue in a new loop.
+        if (discard_errors) {
+          valid = isValid(instance, pc->node, ExpansionOptions(callee_add_defaults), context);
+        }
+        else {
+          Execute(instance, pc->node, path, ExpansionOptions(callee_add_defaults), context);
+        }
+        pc++;
+        DISPATCH();
+      }
+
+      Frame &frame = stack[depth++];
+      frame.return_pc = pc + 1;
+      frame.saved_branch = discard_errors ? context->begin_branch() : 0;
+      frame.add_values_before = context->get_add_values_size();
+      frame.discard_errors = discard_errors;
+      frame.memo_node = kNoNode;
+      if (discard_errors && !callee_add_defaults && context->memoize) {
+        frame.memo_node = pc->node;
+      }
+      frame.add_defaults = add_defaults;
+      frame.count = count;
+      frame.discriminator = discriminator;
+
+      add_defaults = callee_add_defaults;
+      pc = code + program_->blocks[pc->node];
+      DISPATCH();
+    }
+
+    CASE(JUMP_IF_INVALID):
+      pc = valid ? pc + 1 : code + pc->arg;
+      DISPATCH();
+
+    CASE(COUNT_RESET):
+      count = 0;
+      pc++;
+      DISPATCH();
+
+    CASE(DISCRIMINATE): {
+      const Node &node = NODE;
+      if (pc->arg == 0) {
+        discriminator = discriminate(instance, type, node.has(Node::ANY_OF_DISCRIMINATOR), node.any_of_discriminator);
+      }
+      else {
+        discriminator = discriminate(instance, type, node.has(Node::ONE_OF_DISCRIMINATOR), node.one_of_discriminator);
+      }
+      pc++;
+      DISPATCH();
+    }
+
+    CASE(CANDIDATE):
+      pc += is_candidate(compiled_->branches[pc->arg], type, discriminator) ? 1 : 3;
+      DISPATCH();
+
+    CASE(ANY_OF_STEP):
+      if (valid) {
+        count++;
+        if (!add_defaults) {
+          pc = code + pc->arg;
+          DISPATCH();
+        }
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(ANY_OF_CHECK):
+      if (count == 0) {
+        context->add_error([&] { return Error(path.str(), kAnyOfFailed); });
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(ONE_OF_STEP):
+      if (valid && ++count > 1) {
+        pc = code + pc->arg;
+        DISPATCH();
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(ONE_OF_CHECK):
+      if (count != 1) {
+        context->add_error([&] { return Error(path.str(), kOneOfFailed); });
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(NOT_CHECK):
+      if (valid) {
+        context->add_error([&] { return Error(path.str(), kNotFailed); });
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(CONST):
+      if (!values_equal(instance, compiled_->values[NODE.const_value])) {
+        context->add_error([&] { return Error(path.str(), kConst); });
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(ENUM):
+      ValidateEnum(instance, NODE, path, context);
+      pc++;
+      DISPATCH();
+
+    CASE(OBJECT_SECTION):
+      pc = (type & TYPE_OBJECT) ? pc + 1 : code + pc->arg;
+      DISPATCH();
+
+    CASE(REQUIRED): {
+      const Node &node = NODE;
+      for (auto i = node.required.begin; i < node.required.end; i++) {
+        const StringRef &name = compiled_->names[i];
+        const char *name_begin = compiled_->chars(name);
+        if (instance.find(name_begin, name_begin + name.length) == NULL) {
+          context->add_error([&] { return Error(path.str(), FormatErrorMessage(kObjectPropertyIsRequired, compiled_->string(name))); });
+        }
+      }
+      pc++;
+      DISPATCH();
+    }
+
+    CASE(MIN_PROPERTIES):
+      if (instance.size() < NODE.min_properties) {
+        context->add_error([&] { return Error(path.str(), FormatErrorMessage(kObjectMinProperties, UIntToString(NODE.min_properties))); });
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(MAX_PROPERTIES):
+      if (instance.size() > NODE.max_properties) {
+        context->add_error([&] { return Error(path.str(), FormatErrorMessage(kObjectMaxProperties, UIntToString(NODE.max_properties))); });
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(MEMBERS):
+      ValidateMembers(instance, NODE, path, ExpansionOptions(add_defaults), context);
+      pc++;
+      DISPATCH();
+
+    CASE(DEFAULTS):
+      if (add_defaults) {
+        AddDefaults(instance, NODE, context);
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(ARRAY_SECTION):
+      pc = (type & TYPE_ARRAY) ? pc + 1 : code + pc->arg;
+      DISPATCH();
+
+    CASE(MIN_ITEMS):
+      if (instance.size() < static_cast<size_t>(NODE.min_items)) {
+        context->add_error([&] { return Error(path.str(), FormatErrorMessage(kArrayMinItems, IntToString(NODE.min_items))); });
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(MAX_ITEMS):
+      if (instance.size() > static_cast<size_t>(NODE.max_items)) {
+        context->add_error([&] { return Error(path.str(), FormatErrorMessage(kArrayMaxItems, IntToString(NODE.max_items))); });
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(ITEMS): {
+      ExpansionOptions item_options(add_defaults);
+      Json::ArrayIndex instance_size = instance.size();
+      for (Json::ArrayIndex i = 0; i < instance_size && !context->stopped(); ++i) {
+        Execute(instance[i], NODE.items, Path(path, i), item_options, context);
+      }
+      pc++;
+      DISPATCH();
+    }
+
+    CASE(ITEMS_TUPLE): {
+      const Node &node = NODE;
+      ExpansionOptions item_options(add_defaults);
+      Json::ArrayIndex instance_size = instance.size();
+      Json::ArrayIndex items_size = node.items_tuple.size();
+
+      for (Json::ArrayIndex i = 0; i < items_size && i < instance_size && !context->stopped(); ++i) {
+        Execute(instance[i], compiled_->node_lists[node.items_tuple.begin + i], Path(path, i), item_options, context);
+      }
+      if (instance_size > items_size && node.has(Node::ADDITIONAL_ITEMS)) {
+        if (compiled_->nodes[node.additional_items].has(Node::FALSE_SCHEMA)) {
+          context->add_error([&] { return Error(path.str(), kNoAdditionalItems); });
+        }
+        else {
+          for (Json::ArrayIndex i = items_size; i < instance_size && !context->stopped(); ++i) {
+            Execute(instance[i], node.additional_items, Path(path, i), item_options, context);
+          }
+        }
+      }
+      pc++;
+      DISPATCH();
+    }
+
+    CASE(UNIQUE_ITEMS):
+      ValidateUniqueItems(instance, path, context);
+      pc++;
+      DISPATCH();
+
+    CASE(CONTAINS):
+      ValidateContains(instance, NODE, path, context);
+      pc++;
+      DISPATCH();
+
+    CASE(STRING_SECTION):
+      pc = (type & TYPE_STRING) ? pc + 1 : code + pc->arg;
+      DISPATCH();
+
+    CASE(LENGTH):
+      ValidateLength(instance.asString(), NODE, path, context);
+      pc++;
+      DISPATCH();
+
+    CASE(PATTERN):
+      ValidatePattern(instance.asString(), NODE, path, context);
+      pc++;
+      DISPATCH();
+
+    CASE(NUMBER_SECTION):
+      if (type & (TYPE_INTEGER | TYPE_NUMBER)) {
+        number = instance.asDouble();
+        pc++;
+      }
+      else {
+        pc = code + pc->arg;
+      }
+      DISPATCH();
+
+    CASE(MINIMUM):
+      if (number < NODE.minimum) {
+        context->add_error([&] { return Error(path.str(), FormatErrorMessage(kNumberMinimum, DoubleToString(NODE.minimum))); });
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(EXCLUSIVE_MINIMUM):
+      if (number <= NODE.exclusive_minimum) {
+        context->add_error([&] { return Error(path.str(), FormatErrorMessage(kNumberExclusiveMinimum, DoubleToString(NODE.exclusive_minimum))); });
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(MAXIMUM):
+      if (number > NODE.maximum) {
+        context->add_error([&] { return Error(path.str(), FormatErrorMessage(kNumberMaximum, DoubleToString(NODE.maximum))); });
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(EXCLUSIVE_MAXIMUM):
+      if (number >= NODE.exclusive_maximum) {
+        context->add_error([&] { return Error(path.str(), FormatErrorMessage(kNumberExclusiveMaximum, DoubleToString(NODE.exclusive_maximum))); });
+      }
+      pc++;
+      DISPATCH();
+
+    CASE(MULTIPLE_OF): {
+      double divisor = NODE.multiple_of;
+      if (divisor != 0. && floor(number/divisor) != (number/divisor)) {
+        context->add_error([&] { return Error(path.str(), FormatErrorMessage(kNumberDivisible, DoubleToString(divisor))); });
+      }
+      pc++;
+      DISPATCH();
+    }
+  }
+
+#undef CASE
+#undef DISPATCH
+#undef NODE
+}
+
+} // namespace Json
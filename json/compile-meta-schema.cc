@@ -0,0 +1,158 @@
+/*
+    compile-meta-schema.cc -- create precompiled meta-schema tables
+    Copyright 2015-2020 nfotex IT DL GmbH.
+ 
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+ 
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+ 
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+ 
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+ 
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <streambuf>
+
+#include <json/json.h>
+#include <json/SchemaValidator.h>
+
+/*
+  Compiles the meta-schema and writes the result of
+  SchemaValidator::serialize() as C++ source, which is linked into the
+  library so the meta validator is created without parsing JSON.
+
+  With -c, the output file is only compared to the generated source.
+*/
+
+char *prg;
+
+static bool read_file(const std::string &filename, std::string *str) {
+    std::ifstream t(filename.c_str());
+    if (!t.is_open()) {
+        return false;
+    }
+    str->assign((std::istreambuf_iterator<char>(t)), std::istreambuf_iterator<char>());
+    return true;
+}
+
+[[noreturn]]
+void usage(bool error) {
+    FILE *f = error ? stderr : stdout;
+
+    fprintf(f, "usage: %s [-ch] meta-schema.json output.cc\n", prg);
+
+    exit(error ? 1 : 0);
+}
+
+int main(int argc, char *argv[]) {
+    prg = argv[0];
+    auto check = false;
+
+    int c;
+    while ((c = getopt(argc, argv, "ch")) != EOF) {
+        switch (c) {
+            case 'c':
+                check = true;
+                break;
+
+            case 'h':
+                usage(false);
+
+            default:
+                usage(true);
+        }
+    }
+
+    if (optind != argc - 2) {
+        usage(true);
+    }
+
+    std::string input = argv[optind];
+    std::string output = argv[optind + 1];
+
+    std::string schema_str;
+    if (!read_file(input, &schema_str)) {
+        fprintf(stderr, "%s: can't open '%s': %s\n", prg, input.c_str(), strerror(errno));
+        exit(1);
+    }
+
+    std::vector<Json::UInt64> words;
+    try {
+        Json::SchemaValidator validator(schema_str);
+        validator.serialize(&words);
+    }
+    catch (Json::SchemaValidator::Exception &e) {
+        fprintf(stderr, "%s: can't compile '%s': %s\n", prg, input.c_str(), e.type_message().c_str());
+        for (const auto &error : e.errors) {
+            fprintf(stderr, "%s:%s%s %s\n", input.c_str(), error.path.c_str(), error.path.empty() ? "" : ":", error.message.c_str());
+        }
+        exit(1);
+    }
+
+    auto name = input.substr(input.find_last_of('/') + 1);
+    std::ostringstream source;
+    source << "// This file was automatically created from " << name << " by compile-meta-schema. Do not edit directly.\n"
+           << "\n"
+           << "#include <json/SchemaValidator.h>\n"
+           << "\n"
+           << "namespace Json {\n"
+           << "\n"
+           << "const Json::UInt64 SchemaValidator::meta_schema_compiled[] = {\n";
+    for (size_t i = 0; i < words.size(); i++) {
+        char word[32];
+        snprintf(word, sizeof(word), "0x%llxull", static_cast<unsigned long long>(words[i]));
+        source << (i % 4 == 0 ? "    " : " ") << word << (i + 1 < words.size() ? "," : "") << (i % 4 == 3 || i + 1 == words.size() ? "\n" : "");
+    }
+    source << "};\n"
+           << "\n"
+           << "const size_t SchemaValidator::meta_schema_compiled_size = " << words.size() << ";\n"
+           << "\n"
+           << "}\n";
+
+    if (check) {
+        std::string current;
+        if (!read_file(output, &current) || current != source.str()) {
+            fprintf(stderr, "%s: '%s' is out of date, run 'make update_meta_schema'\n", prg, output.c_str());
+            exit(1);
+        }
+        exit(0);
+    }
+
+    std::ofstream out(output.c_str());
+    out << source.str();
+    out.close();
+    if (!out) {
+        fprintf(stderr, "%s: can't write '%s': %s\n", prg, output.c_str(), strerror(errno));
+        exit(1);
+    }
+
+    exit(0);
+}
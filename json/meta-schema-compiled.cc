@@ -0,0 +1,1077 @@
+// This file was automatically created from meta-schema.json by compile-meta-schema. Do not edit directly.
+
+#include <json/SchemaValidator.h>
+
+namespace Json {
+
+const Json::UInt64 SchemaValidator::meta_schema_compiled[] = {
+    0x4a53434f4d50494cull, 0x1ull, 0x38ull, 0x0ull,
+    0x45ull, 0x8080cull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x42ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2dull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x10ull, 0x8ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x10ull, 0x11ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x10ull, 0x1bull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x10ull, 0x28ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x0ull, 0x3dull,
+    0x1ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x0ull, 0x52ull,
+    0x1ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x8ull, 0x58ull,
+    0x19ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x500000004ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x20ull, 0x71ull, 0x5ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x1ull, 0x0ull, 0x9ull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x0ull, 0x76ull,
+    0x1ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x8ull, 0x7cull,
+    0x19ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x0ull, 0xa2ull,
+    0x1ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x10ull, 0xb2ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x10ull, 0xc8ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x200804ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x40ull, 0xe0ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x1ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x11ull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x0ull, 0xe6ull,
+    0x1ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x200004ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x40ull, 0xf3ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x13ull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x20ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x2ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x0ull, 0xf9ull,
+    0x1ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x16ull, 0xfaull,
+    0x19ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2400000804ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x20ull, 0x113ull, 0x5ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x2ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x17ull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x10ull, 0x118ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x10ull, 0x129ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x0ull, 0x133ull,
+    0x1ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2500000004ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x20ull, 0x138ull, 0x5ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x1ull, 0x0ull, 0x1bull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x400000004ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x20ull, 0x145ull, 0x5ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x1dull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xcull, 0x15aull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xcull, 0x170ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x10ull, 0x17cull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x0ull, 0x184ull,
+    0x1ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x820ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x2ull, 0x4ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x3ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x0ull, 0x18aull,
+    0x1ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x8ull, 0x18bull,
+    0x19ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x26ull, 0x1acull,
+    0x20ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x1000000000004ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x4ull, 0x1ccull, 0x7ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x26ull, 0x1dcull,
+    0x20ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x26ull, 0x209ull,
+    0x20ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xcull, 0x230ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x2bull, 0x23eull,
+    0x28ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x10ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x4ull, 0x6ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x26ull, 0x266ull,
+    0x20ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x800ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x4ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x2bull, 0x28full,
+    0x28ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x2bull, 0x2c4ull,
+    0x28ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xcull, 0x2f3ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2000000000004ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xcull, 0x303ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x0ull, 0x30cull,
+    0x1ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x8ull, 0x312ull,
+    0x19ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x10ull, 0x332ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x600804ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x40ull, 0x349ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x5ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x36ull, 0x37ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x0ull, 0x34full,
+    0x1ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x200804ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x40ull, 0x35aull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x39ull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x0ull, 0x360ull,
+    0x1ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x0ull, 0x36eull,
+    0x1ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x804ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x2ull, 0x377ull, 0x7ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x7ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x16ull, 0x386ull,
+    0x19ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x0ull, 0x3a3ull,
+    0x1ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x10ull, 0x3a9ull, 0x6ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x20ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x6ull, 0x8ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x41ull, 0x3b3ull,
+    0x19ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x400ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x8ull,
+    0xfull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2500000004ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x20ull, 0x3ccull, 0x5ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x1ull, 0x0ull, 0x43ull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x2ull, 0x41ull, 0x3d1ull,
+    0x19ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x804ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x2ull, 0x3f5ull, 0x7ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0xffffffffull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0xfull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0xffffffffull, 0xffffffffull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0xffffffffull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0x8ull, 0x14ull, 0x15ull,
+    0x23ull, 0x24ull, 0x2cull, 0x2dull,
+    0x40ull, 0x42ull, 0x8ull, 0x42ull,
+    0x0ull, 0x0ull, 0x20ull, 0x0ull,
+    0x0ull, 0x42ull, 0x0ull, 0x0ull,
+    0x20ull, 0x0ull, 0x0ull, 0xffffffffull,
+    0x0ull, 0x0ull, 0xffffffffull, 0x0ull,
+    0x0ull, 0x10ull, 0x0ull, 0x0ull,
+    0x20ull, 0x0ull, 0x0ull, 0x2dull,
+    0x0ull, 0x8ull, 0x1ull, 0xffffffffull,
+    0xeull, 0x3ull, 0x2ull, 0xffffffffull,
+    0x17ull, 0x4ull, 0x3ull, 0xffffffffull,
+    0x21ull, 0x7ull, 0x4ull, 0xffffffffull,
+    0x2eull, 0xfull, 0x5ull, 0xffffffffull,
+    0x3eull, 0x14ull, 0x6ull, 0xffffffffull,
+    0x53ull, 0x5ull, 0x7ull, 0xffffffffull,
+    0x77ull, 0x5ull, 0xaull, 0xffffffffull,
+    0x95ull, 0x5ull, 0xbull, 0xffffffffull,
+    0x9aull, 0x8ull, 0xcull, 0xffffffffull,
+    0xa3ull, 0xfull, 0xdull, 0xffffffffull,
+    0xb8ull, 0x10ull, 0xeull, 0xffffffffull,
+    0xceull, 0x7ull, 0xfull, 0xffffffffull,
+    0xd5ull, 0xbull, 0x10ull, 0xffffffffull,
+    0xe7ull, 0xcull, 0x12ull, 0xffffffffull,
+    0x11eull, 0xbull, 0x18ull, 0xffffffffull,
+    0x12full, 0x4ull, 0x19ull, 0xffffffffull,
+    0x134ull, 0x4ull, 0x1aull, 0xffffffffull,
+    0x13dull, 0x8ull, 0x1cull, 0xffffffffull,
+    0x14aull, 0x10ull, 0x1eull, 0xffffffffull,
+    0x160ull, 0x10ull, 0x1full, 0xffffffffull,
+    0x176ull, 0x6ull, 0x20ull, 0xffffffffull,
+    0x182ull, 0x2ull, 0x21ull, 0xffffffffull,
+    0x185ull, 0x5ull, 0x22ull, 0xffffffffull,
+    0x1a4ull, 0x8ull, 0x25ull, 0xffffffffull,
+    0x1d3ull, 0x9ull, 0x27ull, 0xffffffffull,
+    0x1fcull, 0xdull, 0x28ull, 0xffffffffull,
+    0x229ull, 0x7ull, 0x29ull, 0xffffffffull,
+    0x236ull, 0x8ull, 0x2aull, 0xffffffffull,
+    0x286ull, 0x9ull, 0x2eull, 0xffffffffull,
+    0x2b7ull, 0xdull, 0x2full, 0xffffffffull,
+    0x2ecull, 0x7ull, 0x30ull, 0xffffffffull,
+    0x2f9ull, 0xaull, 0x31ull, 0xffffffffull,
+    0x309ull, 0x3ull, 0x32ull, 0xffffffffull,
+    0x30dull, 0x5ull, 0x33ull, 0xffffffffull,
+    0x32bull, 0x7ull, 0x34ull, 0xffffffffull,
+    0x338ull, 0x11ull, 0x35ull, 0xffffffffull,
+    0x350ull, 0xaull, 0x38ull, 0xffffffffull,
+    0x361ull, 0xdull, 0x3aull, 0xffffffffull,
+    0x36full, 0x8ull, 0x3bull, 0xffffffffull,
+    0x37eull, 0x8ull, 0x3cull, 0xffffffffull,
+    0x39full, 0x4ull, 0x3dull, 0xffffffffull,
+    0x3a4ull, 0x5ull, 0x3eull, 0xffffffffull,
+    0x3afull, 0x4ull, 0x3full, 0xffffffffull,
+    0x3eaull, 0xbull, 0x44ull, 0xffffffffull,
+    0x0ull, 0x0ull, 0x10ull, 0x5ull,
+    0x1ull, 0x7ull, 0x0ull, 0x6ull,
+    0x0ull, 0x5ull, 0x1ull, 0x1ull,
+    0x0ull, 0x7ull, 0x0ull, 0x7ull,
+    0x0ull, 0x5ull, 0x0ull, 0x4ull,
+    0x5ull, 0x7961727261ull, 0x4ull, 0x7ull,
+    0x6e61656c6f6f62ull, 0x4ull, 0x7ull, 0x72656765746e69ull,
+    0x4ull, 0x4ull, 0x6c6c756eull, 0x4ull,
+    0x6ull, 0x7265626d756eull, 0x4ull, 0x6ull,
+    0x7463656a626full, 0x4ull, 0x6ull, 0x676e69727473ull,
+    0x5ull, 0x0ull, 0x0ull, 0x3fcull,
+    0x746e656d6d6f6324ull, 0x6924676e69727473ull, 0x24676e6972747364ull, 0x6e69727473666572ull,
+    0x616d656863732467ull, 0x6461676e69727473ull, 0x6c616e6f69746964ull, 0x646123736d657449ull,
+    0x6c616e6f69746964ull, 0x69747265706f7250ull, 0x664f6c6c61237365ull, 0x696e696665642f23ull,
+    0x63732f736e6f6974ull, 0x61727241616d6568ull, 0x6123796172726179ull, 0x65642f23664f796eull,
+    0x6e6f6974696e6966ull, 0x616d656863732f73ull, 0x6e6f637961727241ull, 0x6961746e6f637473ull,
+    0x65746e6f6323736eull, 0x69646f636e45746eull, 0x676e69727473676eull, 0x4d746e65746e6f63ull,
+    0x6570795461696465ull, 0x6564676e69727473ull, 0x666564746c756166ull, 0x736e6f6974696e69ull,
+    0x64237463656a626full, 0x636e65646e657065ull, 0x63656a626f736569ull, 0x696665642f232374ull,
+    0x2f736e6f6974696eull, 0x7241676e69727473ull, 0x7961727261796172ull, 0x6564676e69727473ull,
+    0x6f69747069726373ull, 0x65676e697274736eull, 0x6d756e652365736cull, 0x6178657961727261ull,
+    0x72726173656c706dull, 0x73756c6378657961ull, 0x6d6978614d657669ull, 0x7265626d756e6d75ull,
+    0x766973756c637865ull, 0x6d756d696e694d65ull, 0x6f667265626d756eull, 0x6972747374616d72ull,
+    0x657469236669676eull, 0x6665642f2323736dull, 0x736e6f6974696e69ull, 0x41616d656863732full,
+    0x4978616d79617272ull, 0x65642f23736d6574ull, 0x6e6f6974696e6966ull, 0x67654e6e6f6e2f73ull,
+    0x746e496576697461ull, 0x65746e6972656765ull, 0x654c78616d726567ull, 0x65642f236874676eull,
+    0x6e6f6974696e6966ull, 0x67654e6e6f6e2f73ull, 0x746e496576697461ull, 0x5078616d72656765ull,
+    0x6569747265706f72ull, 0x6e696665642f2373ull, 0x6e2f736e6f697469ull, 0x69746167654e6e6full,
+    0x656765746e496576ull, 0x6d756d6978616d72ull, 0x696d7265626d756eull, 0x2f23736d6574496eull,
+    0x6974696e69666564ull, 0x4e6e6f6e2f736e6full, 0x4965766974616765ull, 0x654472656765746eull,
+    0x2f2330746c756166ull, 0x6974696e69666564ull, 0x4e6e6f6e2f736e6full, 0x4965766974616765ull,
+    0x696d72656765746eull, 0x236874676e654c6eull, 0x74696e696665642full, 0x6e6f6e2f736e6f69ull,
+    0x657669746167654eull, 0x4472656765746e49ull, 0x6d30746c75616665ull, 0x7265706f72506e69ull,
+    0x65642f2373656974ull, 0x6e6f6974696e6966ull, 0x67654e6e6f6e2f73ull, 0x746e496576697461ull,
+    0x6166654472656765ull, 0x696e696d30746c75ull, 0x65626d756e6d756dull, 0x6c7069746c756d72ull,
+    0x65626d756e664f65ull, 0x656e6f23746f6e72ull, 0x696665642f23664full, 0x2f736e6f6974696eull,
+    0x7241616d65686373ull, 0x6574746170796172ull, 0x676e697274736e72ull, 0x506e726574746170ull,
+    0x6569747265706f72ull, 0x237463656a626f73ull, 0x69747265706f7270ull, 0x7463656a626f7365ull,
+    0x747265706f727023ull, 0x722373656d614e79ull, 0x62796c6e4f646165ull, 0x65726e61656c6f6full,
+    0x2f23646572697571ull, 0x6974696e69666564ull, 0x697274732f736e6full, 0x747961727241676eull,
+    0x6c746974236e6568ull, 0x74676e6972747365ull, 0x6665642f23657079ull, 0x736e6f6974696e69ull,
+    0x54656c706d69732full, 0x6172726173657079ull, 0x6e696665642f2379ull, 0x732f736e6f697469ull,
+    0x707954656c706d69ull, 0x657571696e757365ull, 0x6f6f62736d657449ull, 0x6e61656cull,
+    0x0ull
+};
+
+const size_t SchemaValidator::meta_schema_compiled_size = 4257;
+
+}
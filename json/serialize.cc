@@ -0,0 +1,779 @@
+/*
+    serialize.cc -- save and load compiled schemata
+    Copyright 2015-2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <json/SchemaValidator.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+/*
+  A compiled schema is stored as a sequence of 64 bit words: a header,
+  then each table of CompiledSchema with its entry count. Every field is
+  written as its own word and strings are packed eight bytes to a word,
+  least significant byte first, so the words can be written as integer
+  literals in generated source and read on any platform.
+
+  Regular expressions are stored as their patterns and compiled again
+  when loading. Json::Values are stored as a type tag followed by their
+  content.
+
+  Files written by save() hold the words least significant byte first,
+  preceded by a file header: magic, source hash, word count and a hash of
+  the words. load_file() maps the file and, on little endian hosts, reads
+  the words in place; the tables of CompiledSchema are still copied out of
+  them and the regular expressions compiled.
+*/
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+namespace {
+
+// "JSCOMPIL"
+const Json::UInt64 kMagic = 0x4a53434f4d50494cull;
+// Increment when the layout changes in a way not caught by the field counts.
+const Json::UInt64 kFormatVersion = 1;
+// "JSCFILE1"
+const Json::UInt64 kFileMagic = 0x4a534346494c4531ull;
+const size_t kFileHeaderWords = 4;
+
+Json::UInt64 swap_bytes(Json::UInt64 word) {
+  Json::UInt64 swapped = 0;
+  for (int i = 0; i < 8; i++) {
+    swapped = (swapped << 8) | (word & 0xff);
+    word >>= 8;
+  }
+  return swapped;
+}
+
+bool is_little_endian() {
+  const Json::UInt64 word = 1;
+  unsigned char first;
+  memcpy(&first, &word, 1);
+  return first == 1;
+}
+
+// Read only mapping of a file, unmapped when destroyed.
+class Mapping {
+public:
+  Mapping() : data(NULL), size(0) { }
+  ~Mapping() {
+    if (data != NULL) {
+      munmap(data, size);
+    }
+  }
+
+  // Returns false if |filename| can't be opened or mapped.
+  bool map(const std::string &filename) {
+    auto fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_size == 0) {
+      close(fd);
+      return false;
+    }
+    auto address = mmap(NULL, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED) {
+      return false;
+    }
+    data = address;
+    size = static_cast<size_t>(st.st_size);
+    return true;
+  }
+
+  // The mapping is page aligned, so it can be read as words.
+  const Json::UInt64 *words() const { return static_cast<const Json::UInt64 *>(data); }
+  size_t word_count() const { return size / sizeof(Json::UInt64); }
+  bool whole_words() const { return size % sizeof(Json::UInt64) == 0; }
+
+private:
+  Mapping(const Mapping &);
+  Mapping &operator=(const Mapping &);
+
+  void *data;
+  size_t size;
+};
+
+
+}
+
+class SchemaValidator::Writer {
+public:
+  explicit Writer(std::vector<Json::UInt64> *words_) : words(words_) { }
+
+  void word(Json::UInt64 value) { words->push_back(value); }
+  void real(double value) {
+    Json::UInt64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    word(bits);
+  }
+
+  void string(const char *data, size_t length) {
+    word(length);
+    for (size_t i = 0; i < length; i += 8) {
+      Json::UInt64 packed = 0;
+      for (size_t j = 0; j < 8 && i + j < length; j++) {
+        packed |= static_cast<Json::UInt64>(static_cast<unsigned char>(data[i + j])) << (8 * j);
+      }
+      word(packed);
+    }
+  }
+  void string(const std::string &str) { string(str.data(), str.length()); }
+
+  void value(const Json::Value &value) {
+    word(value.type());
+    switch (value.type()) {
+      case Json::nullValue:
+        break;
+
+      case Json::intValue:
+        word(static_cast<Json::UInt64>(value.asInt64()));
+        break;
+
+      case Json::uintValue:
+        word(value.asUInt64());
+        break;
+
+      case Json::realValue:
+        real(value.asDouble());
+        break;
+
+      case Json::stringValue: {
+        const char *begin;
+        const char *end;
+        value.getString(&begin, &end);
+        string(begin, static_cast<size_t>(end - begin));
+        break;
+      }
+
+      case Json::booleanValue:
+        word(value.asBool() ? 1 : 0);
+        break;
+
+      case Json::arrayValue:
+        word(value.size());
+        for (const auto &item : value) {
+          this->value(item);
+        }
+        break;
+
+      case Json::objectValue:
+        word(value.size());
+        for (auto it = value.begin(); it != value.end(); ++it) {
+          const char *end;
+          const char *begin = it.memberName(&end);
+          string(begin, static_cast<size_t>(end - begin));
+          this->value(*it);
+        }
+        break;
+    }
+  }
+
+private:
+  std::vector<Json::UInt64> *words;
+};
+
+class SchemaValidator::Reader {
+public:
+  Reader(const Json::UInt64 *begin, size_t count) : current(begin), end(begin + count) { }
+
+  Json::UInt64 word() {
+    if (current == end) {
+      fail();
+    }
+    return *current++;
+  }
+  Json::UInt uint() {
+    auto value = word();
+    if (value > 0xffffffffull) {
+      fail();
+    }
+    return static_cast<Json::UInt>(value);
+  }
+  double real() {
+    auto bits = word();
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+  // Entry count of a table, each entry taking at least |min_words| words.
+  size_t count(size_t min_words) {
+    auto value = word();
+    if (value > static_cast<Json::UInt64>(end - current) / min_words) {
+      fail();
+    }
+    return static_cast<size_t>(value);
+  }
+
+  std::string string() {
+    auto length = word();
+    if (length > static_cast<Json::UInt64>(end - current) * 8) {
+      fail();
+    }
+    std::string str(static_cast<size_t>(length), '\0');
+    for (size_t i = 0; i < str.length(); i += 8) {
+      auto packed = word();
+      for (size_t j = 0; j < 8 && i + j < str.length(); j++) {
+        str[i + j] = static_cast<char>((packed >> (8 * j)) & 0xff);
+      }
+    }
+    return str;
+  }
+
+  Json::Value value() {
+    auto type = word();
+    switch (type) {
+      case Json::nullValue:
+        return Json::Value();
+
+      case Json::intValue:
+        return Json::Value(static_cast<Json::Int64>(word()));
+
+      case Json::uintValue:
+        return Json::Value(static_cast<Json::UInt64>(word()));
+
+      case Json::realValue:
+        return Json::Value(real());
+
+      case Json::stringValue: {
+        auto str = string();
+        return Json::Value(str.data(), str.data() + str.length());
+      }
+
+      case Json::booleanValue:
+        return Json::Value(word() != 0);
+
+      case Json::arrayValue: {
+        Json::Value array(Json::arrayValue);
+        auto size = count(1);
+        for (size_t i = 0; i < size; i++) {
+          array.append(value());
+        }
+        return array;
+      }
+
+      case Json::objectValue: {
+        Json::Value object(Json::objectValue);
+        auto size = count(2);
+        for (size_t i = 0; i < size; i++) {
+          auto name = string();
+          object[name] = value();
+        }
+        return object;
+      }
+
+      default:
+        fail();
+    }
+  }
+
+  bool at_end() const { return current == end; }
+
+  [[noreturn]] static void fail() {
+    Exception e(Exception::INTERNAL);
+    e.errors.push_back(Error("", "invalid compiled schema"));
+    throw e;
+  }
+
+private:
+  const Json::UInt64 *current;
+  const Json::UInt64 *end;
+};
+
+
+void SchemaValidator::serialize(std::vector<Json::UInt64> *words) const {
+  Writer writer(words);
+
+  writer.word(kMagic);
+  writer.word(kFormatVersion);
+  writer.word(node_words());
+  writer.word(root_);
+
+  writer.word(compiled_->nodes.size());
+  for (const auto &node : compiled_->nodes) {
+    write_node(node, words);
+  }
+
+  writer.word(compiled_->node_lists.size());
+  for (auto index : compiled_->node_lists) {
+    writer.word(index);
+  }
+
+  writer.word(compiled_->branches.size());
+  for (const auto &branch : compiled_->branches) {
+    writer.word(branch.types);
+    writer.word(branch.discriminator_values.begin);
+    writer.word(branch.discriminator_values.end);
+  }
+
+  writer.word(compiled_->properties.size());
+  for (const auto &property : compiled_->properties) {
+    writer.word(property.name.offset);
+    writer.word(property.name.length);
+    writer.word(property.schema);
+    writer.word(property.regex);
+  }
+
+  writer.word(compiled_->dependencies.size());
+  for (const auto &dependency : compiled_->dependencies) {
+    writer.word(dependency.name.offset);
+    writer.word(dependency.name.length);
+    writer.word(dependency.schema);
+    writer.word(dependency.required.begin);
+    writer.word(dependency.required.end);
+  }
+
+  writer.word(compiled_->names.size());
+  for (const auto &name : compiled_->names) {
+    writer.word(name.offset);
+    writer.word(name.length);
+  }
+
+  writer.word(compiled_->values.size());
+  for (const auto &value : compiled_->values) {
+    writer.value(value);
+  }
+
+  writer.word(compiled_->enum_slots.size());
+  for (auto slot : compiled_->enum_slots) {
+    writer.word(slot);
+  }
+
+  writer.string(compiled_->strings);
+
+  // Patterns of the regular expressions, recovered from the nodes and properties using them.
+  std::vector<StringRef> patterns(compiled_->regexes.size());
+  for (const auto &node : compiled_->nodes) {
+    if (node.has(Node::PATTERN)) {
+      patterns[node.pattern_regex] = node.pattern;
+    }
+  }
+  for (const auto &property : compiled_->properties) {
+    if (property.regex != kNoRegex) {
+      patterns[property.regex] = property.name;
+    }
+  }
+  writer.word(patterns.size());
+  for (const auto &pattern : patterns) {
+    writer.string(compiled_->string(pattern));
+  }
+}
+
+
+void SchemaValidator::save(const std::string &filename, Json::UInt64 source_hash) const {
+  std::vector<Json::UInt64> words(kFileHeaderWords);
+  serialize(&words);
+  words[0] = kFileMagic;
+  words[1] = source_hash;
+  words[2] = words.size() - kFileHeaderWords;
+  words[3] = hash_words(words.data() + kFileHeaderWords, words.size() - kFileHeaderWords);
+  if (!is_little_endian()) {
+    for (auto &word : words) {
+      word = swap_bytes(word);
+    }
+  }
+
+  // Written to a temporary file and renamed, so concurrent readers never see a partial file.
+  std::vector<char> temporary(filename.begin(), filename.end());
+  const char suffix[] = ".XXXXXX";
+  temporary.insert(temporary.end(), suffix, suffix + sizeof(suffix));
+  auto fd = mkstemp(temporary.data());
+  auto ok = fd >= 0;
+  if (ok) {
+    // Readable by other users of a shared cache directory, like files created with open().
+    ok = fchmod(fd, 0644) == 0;
+    auto data = reinterpret_cast<const char *>(words.data());
+    size_t length = words.size() * sizeof(Json::UInt64);
+    while (ok && length > 0) {
+      auto n = write(fd, data, length);
+      if (n < 0) {
+        ok = errno == EINTR;
+        continue;
+      }
+      data += n;
+      length -= static_cast<size_t>(n);
+    }
+    ok = close(fd) == 0 && ok;
+    ok = ok && rename(temporary.data(), filename.c_str()) == 0;
+  }
+  if (!ok) {
+    Exception e(Exception::INTERNAL);
+    e.errors.push_back(Error("", "can't write '" + filename + "': " + strerror(errno)));
+    if (fd >= 0) {
+      unlink(temporary.data());
+    }
+    throw e;
+  }
+}
+
+
+// static
+SchemaValidator *SchemaValidator::load_file(const std::string &filename, Json::UInt64 source_hash, const Options &options) {
+  Mapping mapping;
+  if (!mapping.map(filename)) {
+    return NULL;
+  }
+  if (!mapping.whole_words() || mapping.word_count() < kFileHeaderWords) {
+    Reader::fail();
+  }
+
+  const Json::UInt64 *words = mapping.words();
+  std::vector<Json::UInt64> swapped;
+  if (words[0] != kFileMagic) {
+    if (swap_bytes(words[0]) != kFileMagic) {
+      Reader::fail();
+    }
+    // Written on a host of the other byte order.
+    swapped.assign(words, words + mapping.word_count());
+    for (auto &word : swapped) {
+      word = swap_bytes(word);
+    }
+    words = swapped.data();
+  }
+
+  if (words[1] != source_hash) {
+    return NULL;
+  }
+  auto count = mapping.word_count() - kFileHeaderWords;
+  if (words[2] != count || words[3] != hash_words(words + kFileHeaderWords, count)) {
+    Reader::fail();
+  }
+
+  return new SchemaValidator(words + kFileHeaderWords, count, options);
+}
+
+
+void SchemaValidator::load(const Json::UInt64 *words, size_t count) {
+  Reader reader(words, count);
+
+  if (reader.word() != kMagic || reader.word() != kFormatVersion || reader.word() != node_words()) {
+    Reader::fail();
+  }
+  compiled_ = std::make_shared<CompiledSchema>();
+  compiled_->root = reader.uint();
+  root_ = compiled_->root;
+
+  compiled_->nodes.resize(reader.count(node_words()));
+  for (auto &node : compiled_->nodes) {
+    read_node(&node, &reader);
+  }
+
+  compiled_->node_lists.resize(reader.count(1));
+  for (auto &index : compiled_->node_lists) {
+    index = reader.uint();
+  }
+
+  compiled_->branches.resize(reader.count(3));
+  for (auto &branch : compiled_->branches) {
+    branch.types = reader.uint();
+    branch.discriminator_values.begin = reader.uint();
+    branch.discriminator_values.end = reader.uint();
+  }
+
+  compiled_->properties.resize(reader.count(4));
+  for (auto &property : compiled_->properties) {
+    property.name.offset = reader.uint();
+    property.name.length = reader.uint();
+    property.schema = reader.uint();
+    property.regex = reader.uint();
+  }
+
+  compiled_->dependencies.resize(reader.count(5));
+  for (auto &dependency : compiled_->dependencies) {
+    dependency.name.offset = reader.uint();
+    dependency.name.length = reader.uint();
+    dependency.schema = reader.uint();
+    dependency.required.begin = reader.uint();
+    dependency.required.end = reader.uint();
+  }
+
+  compiled_->names.resize(reader.count(2));
+  for (auto &name : compiled_->names) {
+    name.offset = reader.uint();
+    name.length = reader.uint();
+  }
+
+  compiled_->values.resize(reader.count(1));
+  compiled_->value_hashes.clear();
+  for (auto &value : compiled_->values) {
+    value = reader.value();
+    compiled_->value_hashes.push_back(hash_value(value));
+  }
+
+  compiled_->enum_slots.resize(reader.count(1));
+  for (auto &slot : compiled_->enum_slots) {
+    slot = reader.uint();
+  }
+
+  compiled_->strings = reader.string();
+
+  auto regexes = reader.count(1);
+  compiled_->regexes.clear();
+  for (size_t i = 0; i < regexes; i++) {
+    add_regex(reader.string());
+  }
+
+  if (!reader.at_end() || !check_compiled()) {
+    Reader::fail();
+  }
+
+  if (engine_ == ENGINE_BYTECODE) {
+    lower();
+  }
+}
+
+
+// static
+size_t SchemaValidator::node_words() {
+  std::vector<Json::UInt64> words;
+  write_node(Node(), &words);
+  return words.size();
+}
+
+
+// static
+void SchemaValidator::write_node(const Node &node, std::vector<Json::UInt64> *words) {
+  Writer writer(words);
+
+  writer.word(node.keywords);
+  writer.word(node.ref);
+  writer.word(node.ref_name.offset);
+  writer.word(node.ref_name.length);
+  writer.word(node.types);
+  writer.word(node.type_name.offset);
+  writer.word(node.type_name.length);
+  writer.word(node.all_of.begin);
+  writer.word(node.all_of.end);
+  writer.word(node.any_of.begin);
+  writer.word(node.any_of.end);
+  writer.word(node.one_of.begin);
+  writer.word(node.one_of.end);
+  writer.word(node.any_of_discriminator.offset);
+  writer.word(node.any_of_discriminator.length);
+  writer.word(node.one_of_discriminator.offset);
+  writer.word(node.one_of_discriminator.length);
+  writer.word(node.not_schema);
+  writer.word(node.if_schema);
+  writer.word(node.then_schema);
+  writer.word(node.else_schema);
+  writer.word(node.const_value);
+  writer.word(node.enum_values.begin);
+  writer.word(node.enum_values.end);
+  writer.word(node.enum_slots.begin);
+  writer.word(node.enum_slots.end);
+  writer.word(node.default_value);
+  writer.word(node.required.begin);
+  writer.word(node.required.end);
+  writer.word(node.min_properties);
+  writer.word(node.max_properties);
+  writer.word(node.properties.begin);
+  writer.word(node.properties.end);
+  writer.word(node.pattern_properties.begin);
+  writer.word(node.pattern_properties.end);
+  writer.word(node.additional_properties);
+  writer.word(node.property_names);
+  writer.word(node.dependencies.begin);
+  writer.word(node.dependencies.end);
+  writer.word(static_cast<Json::UInt64>(node.min_items));
+  writer.word(static_cast<Json::UInt64>(node.max_items));
+  writer.word(node.items);
+  writer.word(node.items_tuple.begin);
+  writer.word(node.items_tuple.end);
+  writer.word(node.additional_items);
+  writer.word(node.contains);
+  writer.word(static_cast<Json::UInt64>(node.min_length));
+  writer.word(static_cast<Json::UInt64>(node.max_length));
+  writer.word(node.pattern.offset);
+  writer.word(node.pattern.length);
+  writer.word(node.pattern_regex);
+  writer.real(node.minimum);
+  writer.real(node.exclusive_minimum);
+  writer.real(node.maximum);
+  writer.real(node.exclusive_maximum);
+  writer.real(node.multiple_of);
+}
+
+
+// static
+void SchemaValidator::read_node(Node *node, Reader *reader_) {
+  Reader &reader = *reader_;
+
+  node->keywords = reader.word();
+  node->ref = reader.uint();
+  node->ref_name.offset = reader.uint();
+  node->ref_name.length = reader.uint();
+  node->types = reader.uint();
+  node->type_name.offset = reader.uint();
+  node->type_name.length = reader.uint();
+  node->all_of.begin = reader.uint();
+  node->all_of.end = reader.uint();
+  node->any_of.begin = reader.uint();
+  node->any_of.end = reader.uint();
+  node->one_of.begin = reader.uint();
+  node->one_of.end = reader.uint();
+  node->any_of_discriminator.offset = reader.uint();
+  node->any_of_discriminator.length = reader.uint();
+  node->one_of_discriminator.offset = reader.uint();
+  node->one_of_discriminator.length = reader.uint();
+  node->not_schema = reader.uint();
+  node->if_schema = reader.uint();
+  node->then_schema = reader.uint();
+  node->else_schema = reader.uint();
+  node->const_value = reader.uint();
+  node->enum_values.begin = reader.uint();
+  node->enum_values.end = reader.uint();
+  node->enum_slots.begin = reader.uint();
+  node->enum_slots.end = reader.uint();
+  node->default_value = reader.uint();
+  node->required.begin = reader.uint();
+  node->required.end = reader.uint();
+  node->min_properties = reader.word();
+  node->max_properties = reader.word();
+  node->properties.begin = reader.uint();
+  node->properties.end = reader.uint();
+  node->pattern_properties.begin = reader.uint();
+  node->pattern_properties.end = reader.uint();
+  node->additional_properties = reader.uint();
+  node->property_names = reader.uint();
+  node->dependencies.begin = reader.uint();
+  node->dependencies.end = reader.uint();
+  node->min_items = static_cast<Json::Int64>(reader.word());
+  node->max_items = static_cast<Json::Int64>(reader.word());
+  node->items = reader.uint();
+  node->items_tuple.begin = reader.uint();
+  node->items_tuple.end = reader.uint();
+  node->additional_items = reader.uint();
+  node->contains = reader.uint();
+  node->min_length = static_cast<Json::Int64>(reader.word());
+  node->max_length = static_cast<Json::Int64>(reader.word());
+  node->pattern.offset = reader.uint();
+  node->pattern.length = reader.uint();
+  node->pattern_regex = reader.uint();
+  node->minimum = reader.real();
+  node->exclusive_minimum = reader.real();
+  node->maximum = reader.real();
+  node->exclusive_maximum = reader.real();
+  node->multiple_of = reader.real();
+}
+
+
+// Returns whether all indices in compiled_ are within their tables.
+bool SchemaValidator::check_compiled() const {
+  const auto &c = *compiled_;
+  auto node = [&c](NodeIndex index) { return index < c.nodes.size(); };
+  auto optional_node = [&c](NodeIndex index) { return index == kNoNode || index < c.nodes.size(); };
+  auto string = [&c](const StringRef &ref) { return ref.offset <= c.strings.size() && ref.length <= c.strings.size() - ref.offset; };
+  auto range = [](const Range &range, size_t size) { return range.begin <= range.end && range.end <= size; };
+  // Subschemas of keywords that are set must exist, only $ref may be unresolved.
+  auto keyword_node = [&c](const Node &n, Json::UInt64 keyword, NodeIndex index) { return !n.has(keyword) || index < c.nodes.size(); };
+
+  if (!node(c.root) || c.branches.size() != c.node_lists.size()) {
+    return false;
+  }
+
+  for (const auto &n : c.nodes) {
+    if (!optional_node(n.ref) || !optional_node(n.not_schema) || !optional_node(n.if_schema) || !optional_node(n.then_schema) || !optional_node(n.else_schema)
+        || !optional_node(n.additional_properties) || !optional_node(n.property_names) || !optional_node(n.items) || !optional_node(n.additional_items) || !optional_node(n.contains)
+        || !string(n.ref_name) || !string(n.type_name) || !string(n.any_of_discriminator) || !string(n.one_of_discriminator) || !string(n.pattern)
+        || !range(n.all_of, c.node_lists.size()) || !range(n.any_of, c.node_lists.size()) || !range(n.one_of, c.node_lists.size()) || !range(n.items_tuple, c.node_lists.size())
+        || !range(n.enum_values, c.values.size()) || !range(n.enum_slots, c.enum_slots.size()) || !range(n.required, c.names.size())
+        || !range(n.properties, c.properties.size()) || !range(n.pattern_properties, c.properties.size()) || !range(n.dependencies, c.dependencies.size())
+        || (n.has(Node::CONST) && n.const_value >= c.values.size()) || (n.has(Node::DEFAULT) && n.default_value >= c.values.size())
+        || (n.has(Node::PATTERN) && n.pattern_regex >= c.regexes.size())
+        || !keyword_node(n, Node::NOT, n.not_schema) || !keyword_node(n, Node::IF, n.if_schema) || !keyword_node(n, Node::ITEMS, n.items)
+        || !keyword_node(n, Node::CONTAINS, n.contains) || !keyword_node(n, Node::ADDITIONAL_PROPERTIES, n.additional_properties)
+        || !keyword_node(n, Node::ADDITIONAL_ITEMS, n.additional_items) || !keyword_node(n, Node::PROPERTY_NAMES, n.property_names)) {
+      return false;
+    }
+    if (n.has(Node::PATTERN_PROPERTIES)) {
+      for (auto i = n.pattern_properties.begin; i < n.pattern_properties.end; i++) {
+        if (c.properties[i].regex == kNoRegex) {
+          return false;
+        }
+      }
+    }
+    // Hashed enums are probed until an empty slot, masking with size - 1.
+    auto slots = n.enum_slots.size();
+    if (slots > 0) {
+      if ((slots & (slots - 1)) != 0 || std::find(c.enum_slots.begin() + n.enum_slots.begin, c.enum_slots.begin() + n.enum_slots.end, Json::UInt(kNoValue)) == c.enum_slots.begin() + n.enum_slots.end) {
+        return false;
+      }
+    }
+  }
+  for (auto index : c.node_lists) {
+    if (!node(index)) {
+      return false;
+    }
+  }
+  for (const auto &branch : c.branches) {
+    if (!range(branch.discriminator_values, c.values.size())) {
+      return false;
+    }
+  }
+  for (const auto &property : c.properties) {
+    if (!string(property.name) || !node(property.schema) || (property.regex != kNoRegex && property.regex >= c.regexes.size())) {
+      return false;
+    }
+  }
+  for (const auto &dependency : c.dependencies) {
+    if (!string(dependency.name) || !optional_node(dependency.schema) || !range(dependency.required, c.names.size())) {
+      return false;
+    }
+  }
+  for (const auto &name : c.names) {
+    if (!string(name)) {
+      return false;
+    }
+  }
+  for (auto slot : c.enum_slots) {
+    if (slot != kNoValue && slot >= c.values.size()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}
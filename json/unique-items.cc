@@ -0,0 +1,291 @@
+/*
+    unique-items.cc -- uniqueItems with bounded memory
+    Copyright 2015-2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <json/SchemaValidator.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <queue>
+
+/*
+  For arrays whose fingerprints would exceed the memory limit, each item
+  is reduced to its hash and index. Fingerprints are collected in a buffer
+  of the allowed size; full buffers are sorted and written as runs to an
+  unlinked temporary file. The runs are then merged, and items with equal
+  hashes are deep compared to rule out collisions.
+*/
+
+namespace Json {
+#if 0
+} // fix auto indent
+#endif
+
+namespace {
+
+struct Fingerprint {
+  Json::UInt64 hash;
+  Json::ArrayIndex index;
+
+  bool operator<(const Fingerprint &other) const {
+    return hash < other.hash || (hash == other.hash && index < other.index);
+  }
+};
+
+class SpillFile {
+public:
+  SpillFile() : file(NULL) { }
+  ~SpillFile() {
+    if (file != NULL) {
+      fclose(file);
+    }
+  }
+
+  bool open(const std::string &directory, std::string *error) {
+    std::string name = directory;
+    if (name.empty()) {
+      auto tmpdir = getenv("TMPDIR");
+      name = tmpdir != NULL && *tmpdir != '\0' ? tmpdir : "/tmp";
+    }
+    name += "/json-schema-XXXXXX";
+
+    std::vector<char> buffer(name.begin(), name.end());
+    buffer.push_back('\0');
+    auto fd = mkstemp(buffer.data());
+    if (fd < 0) {
+      *error = strerror(errno);
+      return false;
+    }
+    // Removed right away, so nothing is left behind.
+    unlink(buffer.data());
+    if ((file = fdopen(fd, "w+b")) == NULL) {
+      *error = strerror(errno);
+      close(fd);
+      return false;
+    }
+    return true;
+  }
+
+  bool write(const Fingerprint *data, size_t count, std::string *error) {
+    if (fwrite(data, sizeof(*data), count, file) != count) {
+      *error = strerror(errno);
+      return false;
+    }
+    return true;
+  }
+
+  bool read(off_t offset, Fingerprint *data, size_t count, std::string *error) {
+    if (fseeko(file, offset * static_cast<off_t>(sizeof(*data)), SEEK_SET) != 0 || fread(data, sizeof(*data), count, file) != count) {
+      *error = ferror(file) ? strerror(errno) : "short read";
+      return false;
+    }
+    return true;
+  }
+
+  bool flush(std::string *error) {
+    if (fflush(file) != 0) {
+      *error = strerror(errno);
+      return false;
+    }
+    return true;
+  }
+
+private:
+  FILE *file;
+};
+
+// Sorted fingerprints read back from one run in the spill file.
+struct Run {
+  off_t next;   // next fingerprint in file not yet read
+  off_t end;
+  std::vector<Fingerprint> buffer;
+  size_t position;
+
+  const Fingerprint &current() const { return buffer[position]; }
+  bool done() const { return position == buffer.size(); }
+};
+
+bool refill(SpillFile *file, Run *run, size_t capacity, std::string *error) {
+  auto count = static_cast<size_t>(std::min(static_cast<off_t>(capacity), run->end - run->next));
+  run->buffer.resize(count);
+  run->position = 0;
+  if (count == 0) {
+    return true;
+  }
+  if (!file->read(run->next, run->buffer.data(), count, error)) {
+    return false;
+  }
+  run->next += static_cast<off_t>(count);
+  return true;
+}
+
+} // namespace
+
+
+void SchemaValidator::ValidateUniqueItemsSpilled(const Json::Value &instance, const Path &path, ValidationContext *context) const {
+  auto capacity = std::max(static_cast<size_t>(unique_items_memory_limit_ / sizeof(Fingerprint)), static_cast<size_t>(2));
+  std::vector<Fingerprint> buffer;
+  buffer.reserve(capacity);
+
+  SpillFile file;
+  std::vector<Run> runs;
+  off_t written = 0;
+  std::string error;
+
+  auto spill = [&]() -> bool {
+    std::sort(buffer.begin(), buffer.end());
+    if (runs.empty() && !file.open(temporary_directory_, &error)) {
+      return false;
+    }
+    if (!file.write(buffer.data(), buffer.size(), &error)) {
+      return false;
+    }
+    Run run;
+    run.next = written;
+    written += static_cast<off_t>(buffer.size());
+    run.end = written;
+    run.position = 0;
+    runs.push_back(run);
+    buffer.clear();
+    return true;
+  };
+
+  Json::ArrayIndex index = 0;
+  for (const Json::Value &item : instance) {
+    if (buffer.size() == capacity && !spill()) {
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kUniqueItemsSpillFailed, error)); });
+      return;
+    }
+    Fingerprint fingerprint;
+    fingerprint.hash = hash_value(item);
+    fingerprint.index = index++;
+    buffer.push_back(fingerprint);
+  }
+  if (!runs.empty() && !buffer.empty() && !spill()) {
+    context->add_error([&] { return Error(path.str(), FormatErrorMessage(kUniqueItemsSpillFailed, error)); });
+    return;
+  }
+
+  // Runs with fingerprints left, smallest current fingerprint on top.
+  auto later = [](const Run *a, const Run *b) { return b->current() < a->current(); };
+  std::priority_queue<Run *, std::vector<Run *>, decltype(later)> heads(later);
+  size_t run_capacity = 0;
+
+  if (runs.empty()) {
+    std::sort(buffer.begin(), buffer.end());
+  }
+  else {
+    // The merge gets the same budget, split among the runs.
+    buffer.clear();
+    buffer.shrink_to_fit();
+    run_capacity = std::max(capacity / runs.size(), static_cast<size_t>(1));
+    if (!file.flush(&error)) {
+      context->add_error([&] { return Error(path.str(), FormatErrorMessage(kUniqueItemsSpillFailed, error)); });
+      return;
+    }
+    for (auto &run : runs) {
+      if (!refill(&file, &run, run_capacity, &error)) {
+        context->add_error([&] { return Error(path.str(), FormatErrorMessage(kUniqueItemsSpillFailed, error)); });
+        return;
+      }
+      heads.push(&run);
+    }
+  }
+
+  // Yields fingerprints in sorted order, from the buffer or by merging the runs.
+  size_t position = 0;
+  auto next = [&](Fingerprint *fingerprint) -> bool {
+    if (runs.empty()) {
+      if (position == buffer.size()) {
+        return false;
+      }
+      *fingerprint = buffer[position++];
+      return true;
+    }
+
+    if (heads.empty()) {
+      return false;
+    }
+    auto run = heads.top();
+    heads.pop();
+    *fingerprint = run->current();
+    if (++run->position == run->buffer.size() && !refill(&file, run, run_capacity, &error)) {
+      return false;
+    }
+    if (!run->done()) {
+      heads.push(run);
+    }
+    return true;
+  };
+
+  // As in memory, report the smallest index equal to an earlier item.
+  auto first = kNoValue;
+  auto second = kNoValue;
+  // Pairwise unequal items of the current hash, each the smallest index of its value.
+  std::vector<Json::ArrayIndex> group;
+  Json::UInt64 group_hash = 0;
+
+  Fingerprint fingerprint;
+  while (next(&fingerprint)) {
+    if (fingerprint.hash != group_hash) {
+      group.clear();
+      group_hash = fingerprint.hash;
+    }
+    // Indices of a hash arrive ascending, later ones can't be reported.
+    if (fingerprint.index >= second) {
+      continue;
+    }
+    auto equal = std::find_if(group.begin(), group.end(), [&](Json::ArrayIndex index) { return values_equal(instance[index], instance[fingerprint.index]); });
+    if (equal != group.end()) {
+      first = *equal;
+      second = fingerprint.index;
+    }
+    else {
+      group.push_back(fingerprint.index);
+    }
+  }
+  if (!error.empty()) {
+    context->add_error([&] { return Error(path.str(), FormatErrorMessage(kUniqueItemsSpillFailed, error)); });
+    return;
+  }
+
+  if (second != kNoValue) {
+    context->add_error([&] { return Error(path.str(), FormatErrorMessage(kArrayItemsNotUnique, UIntToString(first), UIntToString(second))); });
+  }
+}
+
+} // namespace Json
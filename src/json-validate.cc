@@ -33,17 +33,25 @@
 
 
 #include <errno.h>
+#include <getopt.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/resource.h>
 #include <unistd.h>
 
 #include <string>
+#include <atomic>
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <streambuf>
+#include <thread>
 
 #include <json/json.h>
+#include <json/PushValidator.h>
+#include <json/SchemaRegistry.h>
+#include <json/SchemaResolver.h>
 #include <json/SchemaValidator.h>
 
 std::string read_file(const std::string &filename) {
@@ -56,37 +64,134 @@ std::string read_file(const std::string &filename) {
     return str;
 }
 
+// Returns the file: URI of |filename|, used as base URI of schemata without $id.
+std::string file_uri(const std::string &filename) {
+    char *path = realpath(filename.c_str(), NULL);
+    if (path == NULL) {
+        return "file://" + filename;
+    }
+    std::string uri = std::string("file://") + path;
+    free(path);
+    return uri;
+}
+
 std::string read_stdin() {
     std::string str((std::istreambuf_iterator<char>(std::cin)), std::istreambuf_iterator<char>());
     return str;
 }
 
+static Json::SchemaValidator *cached_validator(const std::string &directory, const std::string &schema_file, const std::string &schema_str, const Json::SchemaValidator::Options &options);
+static bool validate_document(const Json::SchemaValidator *validator, const std::string &file, bool add_defaults);
+static bool push_document(const Json::SchemaValidator *validator, const std::string &file);
+static void print_errors(const std::string &document_file, const std::vector<Json::SchemaValidator::Error> &errors);
+
+struct NdjsonStatistics {
+    NdjsonStatistics() : documents(0), invalid(0) { }
+
+    unsigned long documents;
+    unsigned long invalid;
+};
+
+static void validate_ndjson(const Json::SchemaValidator *validator, const std::string &file, unsigned long threads, NdjsonStatistics *statistics);
+static void validate_lines(const Json::SchemaValidator *validator, const std::string &document_file, const std::vector<std::pair<unsigned long, std::string>> &lines, unsigned long threads, NdjsonStatistics *statistics);
+static double cpu_seconds();
+
 [[noreturn]]
 void usage(const char *prg, bool error) {
     FILE *f = error ? stderr : stdout;
     
-    fprintf(f, "usage: %s [-h] [-D] [-p schema-pointer] schema [json]\n", prg);
+    fprintf(f, "usage: %s [-hDNPsT] [-C cache-directory] [-c cache-size] [-j threads] [-m max-errors] [-p schema-pointer] [-r referenced-schema] [-R directory=uri-prefix] [-u unique-items-memory-limit] schema [json ...]\n", prg);
     
     exit(error ? 1 : 0);
     
 }
 
 int main(int argc, char *argv[]) {
-    std::string document;
     std::string pointer;
     auto add_defaults = false;
+    unsigned long unique_items_memory_limit = 0;
+    unsigned long max_errors = 0;
+    unsigned long cache_size = 0;
+    auto print_statistics = false;
+    auto trusted = false;
+    auto push = false;
+    auto ndjson = false;
+    unsigned long threads = std::thread::hardware_concurrency();
+    std::vector<std::string> schema_files;
+    std::shared_ptr<Json::SchemaResolver> resolver;
+    std::string cache_directory;
+
+    static const struct option long_options[] = {
+        { "ndjson", no_argument, NULL, 'N' },
+        { NULL, 0, NULL, 0 }
+    };
 
     int c;
-    while ((c = getopt(argc, argv, "Dhp:")) != EOF) {
+    while ((c = getopt_long(argc, argv, "C:c:Dhj:m:NPp:r:R:sTu:", long_options, NULL)) != EOF) {
         switch (c) {
+            case 'C':
+                cache_directory = optarg;
+                break;
+                
+            case 'c':
+                cache_size = strtoul(optarg, NULL, 10);
+                break;
+                
             case 'D':
                 add_defaults = true;
                 break;
                 
+            case 'j':
+                threads = strtoul(optarg, NULL, 10);
+                break;
+                
+            case 'm':
+                max_errors = strtoul(optarg, NULL, 10);
+                break;
+                
+            case 'N':
+                // One document per line, validated by |threads| threads.
+                ndjson = true;
+                break;
+                
+            case 'P':
+                push = true;
+                break;
+                
             case 'p':
                 pointer = optarg;
                 break;
                 
+            case 'r':
+                schema_files.push_back(optarg);
+                break;
+
+            case 'R': {
+                // Documents of $refs to URIs starting with uri-prefix are read from directory.
+                std::string mapping = optarg;
+                auto equals = mapping.find('=');
+                if (equals == std::string::npos) {
+                    usage(argv[0], true);
+                }
+                if (!resolver) {
+                    resolver = std::make_shared<Json::SchemaResolver>();
+                }
+                resolver->map(mapping.substr(equals + 1), mapping.substr(0, equals));
+                break;
+            }
+                
+            case 's':
+                print_statistics = true;
+                break;
+                
+            case 'T':
+                trusted = true;
+                break;
+                
+            case 'u':
+                unique_items_memory_limit = strtoul(optarg, NULL, 10);
+                break;
+                
             case 'h':
                 usage(argv[0], false);
                 
@@ -95,31 +200,42 @@ int main(int argc, char *argv[]) {
         }
     }
 
-    if (optind == argc) {
+    // Compiled schemata are cached only for a single schema file without remote $refs.
+    if (optind == argc || (push && add_defaults) || (ndjson && (push || add_defaults)) || (!cache_directory.empty() && (!schema_files.empty() || resolver))) {
         usage(argv[0], true);
     }
     
     std::string schema_file = argv[optind++];
     std::string schema_str = read_file(schema_file);
-    
-    std::string document_file;
-    if (optind != argc) {
-        document_file = argv[optind];
-        document = read_file(document_file);
-    }
-    else {
-        document_file = "*stdin*";
-        document = read_stdin();
-    }
+    schema_files.push_back(schema_file);
     
     std::string error_message;
     Json::SchemaValidator *validator = NULL;
     try {
-        if (pointer.length() > 0) {
-            validator = new Json::SchemaValidator(schema_str, pointer);
+        Json::SchemaValidator::Options options(pointer);
+        options.unique_items_memory_limit = unique_items_memory_limit;
+        options.max_errors = max_errors;
+        options.result_cache_size = cache_size;
+        options.resolver = resolver;
+        options.trusted = trusted;
+        if (schema_files.size() > 1) {
+            // Schema documents referenced by $ref are compiled once in a registry.
+            Json::SchemaRegistry registry(options);
+            std::string uri;
+            for (const auto &file : schema_files) {
+                schema_file = file;
+                uri = registry.add(read_file(file), file_uri(file));
+            }
+            if (!pointer.empty()) {
+                uri += "#" + pointer;
+            }
+            validator = new Json::SchemaValidator(registry, uri, options);
+        }
+        else if (!cache_directory.empty()) {
+            validator = cached_validator(cache_directory, schema_file, schema_str, options);
         }
         else {
-            validator = new Json::SchemaValidator(schema_str);
+            validator = new Json::SchemaValidator(schema_str, options);
         }
     }
     catch (Json::SchemaValidator::Exception &e) {
@@ -134,33 +250,114 @@ int main(int argc, char *argv[]) {
         exit(1);
     }
     
-    Json::Reader reader;
-    Json::Value root;
-    
-    bool success;
-    
-    success = reader.parse(document, root);
+    std::vector<std::string> document_files;
+    for (int i = optind; i < argc; i++) {
+        document_files.push_back(argv[i]);
+    }
+    if (document_files.empty()) {
+        document_files.push_back("");
+    }
 
-    if (!success) {
-        fprintf(stderr, "%s", reader.getFormattedErrorMessages().c_str());
-        exit(1);
+    if (ndjson) {
+        if (threads == 0) {
+            threads = 1;
+        }
+        NdjsonStatistics statistics;
+        auto start = std::chrono::steady_clock::now();
+        auto cpu_start = cpu_seconds();
+        for (const auto &file : document_files) {
+            validate_ndjson(validator, file, threads, &statistics);
+        }
+        auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        auto cpu = cpu_seconds() - cpu_start;
+        fprintf(stderr, "%lu documents, %lu invalid, %.3fs with %lu threads: %.0f documents/s, %.0f documents/s per core\n", statistics.documents, statistics.invalid, seconds, threads, seconds > 0 ? statistics.documents / seconds : 0.0, cpu > 0 ? statistics.documents / cpu : 0.0);
+        exit(statistics.invalid == 0 ? 0 : 1);
+    }
+
+    auto ok = true;
+    for (const auto &file : document_files) {
+        if (!(push ? push_document(validator, file) : validate_document(validator, file, add_defaults))) {
+            ok = false;
+        }
+    }
+
+    if (print_statistics) {
+        auto statistics = validator->cache_statistics();
+        fprintf(stderr, "cache: %lu hits, %lu misses, %lu evictions, %lu entries\n", statistics.hits, statistics.misses, statistics.evictions, statistics.entries);
+    }
+
+    exit(ok ? 0 : 1);
+}
+
+
+// Loads the compiled schema from |directory| or compiles it and saves it there.
+// Files are named after the schema file and pointer and hold the hash of their contents,
+// so a changed schema is compiled again.
+static Json::SchemaValidator *cached_validator(const std::string &directory, const std::string &schema_file, const std::string &schema_str, const Json::SchemaValidator::Options &options) {
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.jsc", static_cast<unsigned long long>(Json::SchemaValidator::source_hash(schema_file, options.schema_pointer)));
+    auto filename = directory + "/" + name;
+    auto hash = Json::SchemaValidator::source_hash(schema_str, options.schema_pointer);
+
+    try {
+        auto validator = Json::SchemaValidator::load_file(filename, hash, options);
+        if (validator != NULL) {
+            return validator;
+        }
+    }
+    catch (Json::SchemaValidator::Exception &e) {
+        // Invalid file, replaced below.
+    }
+
+    auto validator = new Json::SchemaValidator(schema_str, options);
+    try {
+        validator->save(filename, hash);
+    }
+    catch (Json::SchemaValidator::Exception &e) {
+        for (const auto &error : e.errors) {
+            fprintf(stderr, "warning: %s\n", error.message.c_str());
+        }
+    }
+    return validator;
+}
+
+
+// Validates one document, |file| empty for standard input. Returns whether it is valid.
+static bool validate_document(const Json::SchemaValidator *validator, const std::string &file, bool add_defaults) {
+    std::string document_file;
+    std::string document;
+    if (!file.empty()) {
+        document_file = file;
+        document = read_file(document_file);
+    }
+    else {
+        document_file = "*stdin*";
+        document = read_stdin();
     }
 
     std::vector<Json::SchemaValidator::Error> errors;
     bool ok;
-    
+    Json::Value root;
+
     if (add_defaults) {
-        ok = validator->validate_and_expand(root, true, &errors);
+        Json::Reader reader;
+
+        if (reader.parse(document, root)) {
+            ok = validator->validate_and_expand(root, true, &errors);
+        }
+        else {
+            // Reports the parse errors in the same format as without -D.
+            ok = validator->validate_document(document, &errors);
+        }
     }
     else {
-        ok = validator->validate(root, &errors);
+        // Parses the document unless its result is cached.
+        ok = validator->validate_document(document, &errors);
     }
 
     if (!ok) {
-        for (std::vector<Json::SchemaValidator::Error>::const_iterator it = errors.begin(); it != errors.end(); ++it) {
-            fprintf(stderr, "%s:%s%s %s\n", document_file.c_str(), it->path.c_str(), it->path.empty() ? "" : ":",  it->message.c_str());
-        }
-        exit(1);
+        print_errors(document_file, errors);
+        return false;
     }
     
     if (add_defaults) {
@@ -169,5 +366,147 @@ int main(int argc, char *argv[]) {
         printf("%s", writer.write(root).c_str());
     }
     
-    exit(0);
+    return true;
+}
+
+
+// Validates one document while reading it, |file| empty for standard input.
+// Reading stops at the first error. Returns whether it is valid.
+static bool push_document(const Json::SchemaValidator *validator, const std::string &file) {
+    std::string document_file;
+    FILE *f;
+    if (!file.empty()) {
+        document_file = file;
+        if ((f = fopen(file.c_str(), "rb")) == NULL) {
+            fprintf(stderr, "can't open '%s': %s\n", file.c_str(), strerror(errno));
+            exit(1);
+        }
+    }
+    else {
+        document_file = "*stdin*";
+        f = stdin;
+    }
+
+    std::vector<Json::SchemaValidator::Error> errors;
+    Json::PushValidator push(*validator, &errors);
+    char buffer[65536];
+    size_t n;
+    while (!push.stopped() && (n = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+        push.feed(buffer, n);
+    }
+    if (ferror(f)) {
+        fprintf(stderr, "can't read '%s': %s\n", document_file.c_str(), strerror(errno));
+        exit(1);
+    }
+    if (f != stdin) {
+        fclose(f);
+    }
+
+    if (!push.finish()) {
+        print_errors(document_file, errors);
+        return false;
+    }
+
+    return true;
+}
+
+
+// Validates the newline delimited documents in |file|, |file| empty for standard input.
+// Results are printed to standard output in input order, one line per valid document.
+static void validate_ndjson(const Json::SchemaValidator *validator, const std::string &file, unsigned long threads, NdjsonStatistics *statistics) {
+    std::string document_file;
+    std::ifstream f;
+    if (!file.empty()) {
+        document_file = file;
+        f.open(file.c_str());
+        if (!f.is_open()) {
+            fprintf(stderr, "can't open '%s': %s\n", file.c_str(), strerror(errno));
+            exit(1);
+        }
+    }
+    else {
+        document_file = "*stdin*";
+    }
+    std::istream &in = file.empty() ? std::cin : f;
+
+    // Lines are read in batches, validated concurrently and printed before the next batch is read.
+    const size_t batch_size = 1024 * threads;
+    std::vector<std::pair<unsigned long, std::string>> lines;
+    std::string line;
+    unsigned long line_number = 0;
+    while (std::getline(in, line)) {
+        line_number++;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.find_first_not_of(" \t") == std::string::npos) {
+            continue;
+        }
+        lines.push_back(std::make_pair(line_number, std::move(line)));
+        if (lines.size() == batch_size) {
+            validate_lines(validator, document_file, lines, threads, statistics);
+            lines.clear();
+        }
+    }
+    if (in.bad()) {
+        fprintf(stderr, "can't read '%s': %s\n", document_file.c_str(), strerror(errno));
+        exit(1);
+    }
+    validate_lines(validator, document_file, lines, threads, statistics);
+}
+
+
+static void validate_lines(const Json::SchemaValidator *validator, const std::string &document_file, const std::vector<std::pair<unsigned long, std::string>> &lines, unsigned long threads, NdjsonStatistics *statistics) {
+    std::vector<std::string> results(lines.size());
+    std::atomic<size_t> next(0);
+    std::atomic<unsigned long> invalid(0);
+
+    auto worker = [&]() {
+        std::vector<Json::SchemaValidator::Error> errors;
+        size_t i;
+        while ((i = next++) < lines.size()) {
+            auto prefix = document_file + ":" + std::to_string(lines[i].first) + ":";
+            if (validator->validate_document(lines[i].second, &errors)) {
+                results[i] = prefix + " valid\n";
+            }
+            else {
+                invalid++;
+                for (const auto &error : errors) {
+                    results[i] += prefix + error.path + (error.path.empty() ? "" : ":") + " " + error.message + "\n";
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned long t = 1; t < threads && t < lines.size(); t++) {
+        workers.push_back(std::thread(worker));
+    }
+    worker();
+    for (auto &thread : workers) {
+        thread.join();
+    }
+
+    for (const auto &result : results) {
+        fputs(result.c_str(), stdout);
+    }
+    statistics->documents += lines.size();
+    statistics->invalid += invalid;
+}
+
+
+// Returns the processor time used by all threads.
+static double cpu_seconds() {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) < 0) {
+        return 0;
+    }
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+
+static void print_errors(const std::string &document_file, const std::vector<Json::SchemaValidator::Error> &errors) {
+    for (std::vector<Json::SchemaValidator::Error>::const_iterator it = errors.begin(); it != errors.end(); ++it) {
+        fprintf(stderr, "%s:%s%s %s\n", document_file.c_str(), it->path.c_str(), it->path.empty() ? "" : ":",  it->message.c_str());
+    }
 }
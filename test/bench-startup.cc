@@ -0,0 +1,208 @@
+/*
+    bench-startup.cc -- benchmark time to first validation
+    Copyright 2015-2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <fstream>
+#include <streambuf>
+#include <vector>
+
+#include <json/json.h>
+#include <json/SchemaValidator.h>
+
+/*
+  Measures the time from starting a process to the end of its first
+  validation, which includes creating the meta validator, and compares
+  it to creating and using a second validator in the same process.
+
+  The schema and document are the first of a JSON-Schema-Test-Suite
+  file. Each run is done in a forked child, so nothing is initialized
+  yet.
+*/
+
+char *prg;
+
+unsigned long runs = 100;
+
+struct Sample {
+    double first_ns;
+    double second_ns;
+};
+
+static bool run_child(const Json::Value &schema, const Json::Value &data, Sample *sample);
+static double elapsed_ns(std::chrono::steady_clock::time_point start);
+static void print_times(const char *name, std::vector<double> times);
+
+
+std::string read_file(const std::string &filename) {
+    std::ifstream t(filename.c_str());
+    std::string str((std::istreambuf_iterator<char>(t)), std::istreambuf_iterator<char>());
+    return str;
+}
+
+[[noreturn]]
+void usage(bool error) {
+    FILE *f = error ? stderr : stdout;
+
+    fprintf(f, "usage: %s [-h] [-n runs] test-file\n", prg);
+
+    exit(error ? 1 : 0);
+}
+
+int main(int argc, char *argv[]) {
+    prg = argv[0];
+
+    int c;
+    while ((c = getopt(argc, argv, "hn:")) != EOF) {
+        switch (c) {
+            case 'h':
+                usage(false);
+
+            case 'n':
+                runs = strtoul(optarg, NULL, 10);
+                break;
+
+            default:
+                usage(true);
+        }
+    }
+
+    if (optind != argc - 1) {
+        usage(true);
+    }
+
+    std::string test_str = read_file(argv[optind]);
+
+    if (test_str.length() == 0) {
+        fprintf(stderr, "%s: can't read test case '%s': %s\n", prg, argv[optind], strerror(errno));
+        exit(1);
+    }
+
+    Json::Reader reader;
+    Json::Value test_suite;
+
+    if (!reader.parse(test_str, test_suite)) {
+        fprintf(stderr, "%s: can't parse test case '%s':\n", prg, argv[optind]);
+        fprintf(stderr, "%s", reader.getFormattedErrorMessages().c_str());
+        exit(1);
+    }
+
+    const Json::Value &schema = test_suite[0]["schema"];
+    const Json::Value &data = test_suite[0]["tests"][0]["data"];
+
+    std::vector<double> first;
+    std::vector<double> second;
+    for (unsigned long i = 0; i < runs; i++) {
+        Sample sample;
+        if (!run_child(schema, data, &sample)) {
+            exit(1);
+        }
+        first.push_back(sample.first_ns);
+        second.push_back(sample.second_ns);
+    }
+
+    printf("%-28s %12s %12s\n", "", "median", "min");
+    print_times("first validation", first);
+    print_times("second validation", second);
+
+    exit(0);
+}
+
+
+// Creates two validators in a new process, timing each including its first validation.
+static bool run_child(const Json::Value &schema, const Json::Value &data, Sample *sample) {
+    int fds[2];
+    if (pipe(fds) < 0) {
+        fprintf(stderr, "%s: can't create pipe: %s\n", prg, strerror(errno));
+        return false;
+    }
+
+    auto pid = fork();
+    if (pid < 0) {
+        fprintf(stderr, "%s: can't fork: %s\n", prg, strerror(errno));
+        return false;
+    }
+
+    if (pid == 0) {
+        close(fds[0]);
+        Sample result;
+        std::vector<Json::SchemaValidator::Error> errors;
+        try {
+            auto start = std::chrono::steady_clock::now();
+            Json::SchemaValidator first(schema);
+            first.validate(data, &errors);
+            result.first_ns = elapsed_ns(start);
+
+            start = std::chrono::steady_clock::now();
+            Json::SchemaValidator second(schema);
+            second.validate(data, &errors);
+            result.second_ns = elapsed_ns(start);
+        }
+        catch (Json::SchemaValidator::Exception &e) {
+            fprintf(stderr, "%s: can't create validator: %s\n", prg, e.type_message().c_str());
+            _exit(1);
+        }
+        _exit(write(fds[1], &result, sizeof(result)) == sizeof(result) ? 0 : 1);
+    }
+
+    close(fds[1]);
+    auto ok = read(fds[0], sample, sizeof(*sample)) == sizeof(*sample);
+    close(fds[0]);
+
+    int status;
+    if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        ok = false;
+    }
+    if (!ok) {
+        fprintf(stderr, "%s: benchmark process failed\n", prg);
+    }
+    return ok;
+}
+
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+static void print_times(const char *name, std::vector<double> times) {
+    std::sort(times.begin(), times.end());
+    printf("%-28s %10.1fus %10.1fus\n", name, times[times.size() / 2] / 1e3, times[0] / 1e3);
+}
@@ -0,0 +1,251 @@
+/*
+    bench-validate.cc -- benchmark SchemaValidator class
+    Copyright 2015-2020 nfotex IT DL GmbH.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <string>
+#include <fstream>
+#include <streambuf>
+
+#include <json/json.h>
+#include <json/SchemaValidator.h>
+
+/*
+  Runs the test cases of JSON-Schema-Test-Suite files repeatedly and
+  reports the time spent constructing validators and validating.
+
+  With -b, the bytecode engine is used instead of the interpreter.
+  With -i, is_valid() is timed instead of validate().
+  With -T, schemata are not checked against the meta-schema.
+  With -v, the timing of each schema is reported as well.
+*/
+
+char *prg;
+
+unsigned long iterations = 1000;
+Json::SchemaValidator::Engine engine = Json::SchemaValidator::ENGINE_INTERPRETER;
+bool verbose = false;
+bool only_validity = false;
+bool trusted = false;
+
+struct Timing {
+    Timing() : validators(0), validations(0), construct_ns(0), validate_ns(0) { }
+
+    unsigned long validators;
+    unsigned long validations;
+    double construct_ns;
+    double validate_ns;
+    Json::SchemaValidator::ConstructionTiming phases;
+};
+
+static bool bench_file(const std::string &filename, Timing *total);
+static double elapsed_ns(std::chrono::steady_clock::time_point start);
+static void print_timing(const char *name, const Timing &timing);
+static void add_phases(Json::SchemaValidator::ConstructionTiming *sum, const Json::SchemaValidator::ConstructionTiming &phases);
+static void print_phases(const Json::SchemaValidator::ConstructionTiming &phases);
+
+
+std::string read_file(const std::string &filename) {
+    std::ifstream t(filename.c_str());
+    std::string str((std::istreambuf_iterator<char>(t)), std::istreambuf_iterator<char>());
+    return str;
+}
+
+[[noreturn]]
+void usage(bool error) {
+    FILE *f = error ? stderr : stdout;
+
+    fprintf(f, "usage: %s [-bhiTv] [-n iterations] test-file ...\n", prg);
+
+    exit(error ? 1 : 0);
+}
+
+int main(int argc, char *argv[]) {
+    prg = argv[0];
+
+    int c;
+    while ((c = getopt(argc, argv, "bhin:Tv")) != EOF) {
+        switch (c) {
+            case 'b':
+                engine = Json::SchemaValidator::ENGINE_BYTECODE;
+                break;
+
+            case 'h':
+                usage(false);
+
+            case 'i':
+                only_validity = true;
+                break;
+
+            case 'n':
+                iterations = strtoul(optarg, NULL, 10);
+                break;
+
+            case 'T':
+                trusted = true;
+                break;
+
+            case 'v':
+                verbose = true;
+                break;
+
+            default:
+                usage(true);
+        }
+    }
+
+    if (optind == argc) {
+        usage(true);
+    }
+
+    printf("%-28s %10s %12s %12s %14s\n", "file", "validations", "construct", "validate", "per validation");
+
+    Timing total;
+    unsigned int err = 0;
+    for (int i = optind; i < argc; i++) {
+        if (!bench_file(argv[i], &total)) {
+            err++;
+        }
+    }
+
+    print_timing("total", total);
+    print_phases(total.phases);
+
+    exit(err == 0 ? 0 : 1);
+}
+
+
+static bool bench_file(const std::string &filename, Timing *total) {
+    std::string test_str = read_file(filename);
+
+    if (test_str.length() == 0) {
+        fprintf(stderr, "%s: can't read test case '%s': %s\n", prg, filename.c_str(), strerror(errno));
+        return false;
+    }
+
+    Json::Reader reader;
+    Json::Value test_suite;
+
+    if (!reader.parse(test_str, test_suite)) {
+        fprintf(stderr, "%s: can't parse test case '%s':\n", prg, filename.c_str());
+        fprintf(stderr, "%s", reader.getFormattedErrorMessages().c_str());
+        return false;
+    }
+
+    Timing timing;
+    std::vector<Json::SchemaValidator::Error> errors;
+
+    for (Json::Value::ArrayIndex i = 0; i < test_suite.size(); i++) {
+        const Json::Value &test = test_suite[i];
+        Json::SchemaValidator *validator = NULL;
+        Json::SchemaValidator::Options options(engine);
+        options.trusted = trusted;
+
+        auto start = std::chrono::steady_clock::now();
+        try {
+            validator = new Json::SchemaValidator(test["schema"], options);
+        }
+        catch (Json::SchemaValidator::Exception &e) {
+            // Schemata we can't handle are skipped, test-validate reports them.
+            continue;
+        }
+        timing.construct_ns += elapsed_ns(start);
+        timing.validators++;
+        add_phases(&timing.phases, validator->construction_timing());
+
+        const Json::Value &tests = test["tests"];
+
+        start = std::chrono::steady_clock::now();
+        for (unsigned long n = 0; n < iterations; n++) {
+            for (Json::Value::ArrayIndex j = 0; j < tests.size(); j++) {
+                if (only_validity) {
+                    validator->is_valid(tests[j]["data"]);
+                }
+                else {
+                    validator->validate(tests[j]["data"], &errors);
+                }
+            }
+        }
+        auto validate_ns = elapsed_ns(start);
+        timing.validate_ns += validate_ns;
+        timing.validations += iterations * tests.size();
+
+        if (verbose) {
+            Timing schema_timing;
+            schema_timing.validations = iterations * tests.size();
+            schema_timing.validate_ns = validate_ns;
+            print_timing(("  " + test["description"].asString()).c_str(), schema_timing);
+        }
+
+        delete validator;
+    }
+
+    auto name = filename.substr(filename.find_last_of('/') + 1);
+    print_timing(name.c_str(), timing);
+
+    total->validators += timing.validators;
+    total->validations += timing.validations;
+    total->construct_ns += timing.construct_ns;
+    total->validate_ns += timing.validate_ns;
+    add_phases(&total->phases, timing.phases);
+
+    return true;
+}
+
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+static void print_timing(const char *name, const Timing &timing) {
+    printf("%-28s %10lu %10.3fms %10.3fms %12.1fns\n", name, timing.validations, timing.construct_ns / 1e6, timing.validate_ns / 1e6, timing.validations > 0 ? timing.validate_ns / timing.validations : 0.0);
+}
+
+
+static void add_phases(Json::SchemaValidator::ConstructionTiming *sum, const Json::SchemaValidator::ConstructionTiming &phases) {
+    sum->parse_ns += phases.parse_ns;
+    sum->meta_validation_ns += phases.meta_validation_ns;
+    sum->collection_ns += phases.collection_ns;
+    sum->resolution_ns += phases.resolution_ns;
+    sum->compile_ns += phases.compile_ns;
+}
+
+
+static void print_phases(const Json::SchemaValidator::ConstructionTiming &phases) {
+    printf("construct: meta-validation %.3fms, ids/refs %.3fms, ref chains %.3fms, compile %.3fms\n", phases.meta_validation_ns / 1e6, phases.collection_ns / 1e6, phases.resolution_ns / 1e6, phases.compile_ns / 1e6);
+}
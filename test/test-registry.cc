@@ -0,0 +1,115 @@
+/*
+    test-registry.cc -- test SchemaRegistry
+    Copyright 2018 nfotex IT DL GmbH.
+ 
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+ 
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+ 
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in
+       the documentation and/or other materials provided with the
+       distribution.
+ 
+    3. Neither the name Google Inc., nfotex IT DL GmbH, nor the names of
+       its contributors may be used to endorse or promote products derived
+       from this software without specific prior written permission.
+ 
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+    OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+    LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+    THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <streambuf>
+#include <string>
+
+#include <json/SchemaRegistry.h>
+
+/*
+  Runs the operations given as options on one SchemaRegistry, in order:
+  -a uri=file adds the schema document in file for uri, -v uri creates a
+  validator for uri. The result of each operation is printed.
+*/
+
+static std::string read_file(const std::string &filename) {
+    std::ifstream t(filename.c_str());
+    if (!t.is_open()) {
+        fprintf(stderr, "can't open '%s'\n", filename.c_str());
+        exit(1);
+    }
+    std::string str((std::istreambuf_iterator<char>(t)), std::istreambuf_iterator<char>());
+    return str;
+}
+
+static void print_error(const std::string &operation, Json::SchemaValidator::Exception &e) {
+    printf("%s: %s\n", operation.c_str(), e.type_message().c_str());
+    for (const auto &error : e.errors) {
+        printf("  %s%s%s\n", error.path.c_str(), error.path.empty() ? "" : ": ", error.message.c_str());
+    }
+}
+
+[[noreturn]]
+static void usage(const char *prg) {
+    fprintf(stderr, "usage: %s [-a uri=file] [-v uri] ...\n", prg);
+    exit(1);
+}
+
+int main(int argc, char *argv[]) {
+    Json::SchemaRegistry registry;
+
+    int c;
+    while ((c = getopt(argc, argv, "a:v:")) != EOF) {
+        std::string argument = optarg != NULL ? optarg : "";
+        switch (c) {
+            case 'a': {
+                auto equals = argument.find('=');
+                if (equals == std::string::npos) {
+                    usage(argv[0]);
+                }
+                auto uri = argument.substr(0, equals);
+                try {
+                    registry.add(read_file(argument.substr(equals + 1)), uri);
+                    printf("add %s: ok\n", uri.c_str());
+                }
+                catch (Json::SchemaValidator::Exception &e) {
+                    print_error("add " + uri, e);
+                }
+                break;
+            }
+
+            case 'v':
+                try {
+                    Json::SchemaValidator validator(registry, argument);
+                    printf("validator %s: ok\n", argument.c_str());
+                }
+                catch (Json::SchemaValidator::Exception &e) {
+                    print_error("validator " + argument, e);
+                }
+                break;
+
+            default:
+                usage(argv[0]);
+        }
+    }
+
+    if (optind != argc) {
+        usage(argv[0]);
+    }
+
+    exit(0);
+}
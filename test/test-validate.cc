@@ -37,17 +37,37 @@
 #include <unistd.h>
 
 #include <string>
+#include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <streambuf>
+#include <thread>
 
 #include <json/json.h>
+#include <json/PushValidator.h>
+#include <json/SchemaRegistry.h>
+#include <json/SchemaResolver.h>
 #include <json/SchemaValidator.h>
+#include <json/StreamValidator.h>
 
 char *prg;
 
 bool verbose = false;
+Json::SchemaValidator::Engine engine = Json::SchemaValidator::ENGINE_INTERPRETER;
+unsigned long unique_items_memory_limit = 0;
+bool memoize = false;
+unsigned long cache_size = 0;
+unsigned long threads = 0;
+bool use_registry = false;
+bool trusted = false;
+bool use_file = false;
+bool use_stream = false;
+bool use_push = false;
+std::shared_ptr<Json::SchemaResolver> resolver;
 
 static bool run_test(const Json::Value &test, unsigned int index);
+static void replay(const Json::Value &value, Json::StreamValidator *stream, bool repeat_members = false);
+static bool same_errors(std::vector<Json::SchemaValidator::Error> a, std::vector<Json::SchemaValidator::Error> b);
 
 
 std::string read_file(const std::string &filename) {
@@ -60,7 +80,7 @@ std::string read_file(const std::string &filename) {
 void usage(bool error) {
     FILE *f = error ? stderr : stdout;
     
-    fprintf(f, "usage: %s [-hv] test\n", prg);
+    fprintf(f, "usage: %s [-bEhMPrSTv] [-c cache-size] [-j threads] [-R remotes-directory] [-u unique-items-memory-limit] test\n", prg);
     
     exit(error ? 1 : 0);
     
@@ -72,11 +92,57 @@ int main(int argc, char *argv[]) {
     prg = argv[0];
     
     int c;
-    while ((c = getopt(argc, argv, "hv")) != EOF) {
+    while ((c = getopt(argc, argv, "bc:Ehj:MPrR:STu:v")) != EOF) {
         switch (c) {
+            case 'b':
+                engine = Json::SchemaValidator::ENGINE_BYTECODE;
+                break;
+
+            case 'c':
+                cache_size = strtoul(optarg, NULL, 10);
+                break;
+
+            case 'E':
+                use_stream = true;
+                break;
+
             case 'h':
                 usage(false);
                 
+            case 'j':
+                threads = strtoul(optarg, NULL, 10);
+                break;
+
+            case 'M':
+                memoize = true;
+                break;
+
+            case 'P':
+                use_push = true;
+                break;
+
+            case 'r':
+                use_registry = true;
+                break;
+
+            case 'R':
+                // Remote schemata of JSON-Schema-Test-Suite.
+                resolver = std::make_shared<Json::SchemaResolver>();
+                resolver->map("http://localhost:1234/", optarg);
+                break;
+
+            case 'S':
+                use_file = true;
+                break;
+
+            case 'T':
+                trusted = true;
+                break;
+
+            case 'u':
+                unique_items_memory_limit = strtoul(optarg, NULL, 10);
+                break;
+
             case 'v':
                 verbose = true;
                 break;
@@ -106,10 +172,28 @@ int main(int argc, char *argv[]) {
         exit(1);
     }
     
-    unsigned int err = 0;
-    for (Json::Value::ArrayIndex i = 0; i < test_suite.size(); i++) {
-        if (!run_test(test_suite[i], i) ) {
-            err++;
+    std::atomic<unsigned int> err(0);
+    if (threads > 0) {
+        // Each thread runs every threads-th test, creating validators concurrently.
+        std::vector<std::thread> workers;
+        for (unsigned long t = 0; t < threads; t++) {
+            workers.push_back(std::thread([&test_suite, &err, t]() {
+                for (Json::Value::ArrayIndex i = static_cast<Json::Value::ArrayIndex>(t); i < test_suite.size(); i += static_cast<Json::Value::ArrayIndex>(threads)) {
+                    if (!run_test(test_suite[i], i)) {
+                        err++;
+                    }
+                }
+            }));
+        }
+        for (auto &worker : workers) {
+            worker.join();
+        }
+    }
+    else {
+        for (Json::Value::ArrayIndex i = 0; i < test_suite.size(); i++) {
+            if (!run_test(test_suite[i], i) ) {
+                err++;
+            }
         }
     }
     
@@ -129,7 +213,34 @@ static bool run_test(const Json::Value &test, unsigned int index) {
             validator = Json::SchemaValidator::create_meta_validator();
         }
         else {
-            validator = new Json::SchemaValidator(schema);
+            Json::SchemaValidator::Options options(engine);
+            options.unique_items_memory_limit = unique_items_memory_limit;
+            options.memoize = memoize;
+            options.result_cache_size = cache_size;
+            options.resolver = resolver;
+            options.trusted = trusted;
+            if (use_registry) {
+                // Validator shares the compiled schema with the registry.
+                Json::SchemaRegistry registry(options);
+                auto uri = registry.add(schema, "urn:test");
+                validator = new Json::SchemaValidator(registry, uri, options);
+            }
+            else {
+                validator = new Json::SchemaValidator(schema, options);
+            }
+            if (use_file) {
+                // Validate with a copy saved to and loaded from a file.
+                auto tmpdir = getenv("TMPDIR");
+                std::string filename = std::string(tmpdir != NULL ? tmpdir : "/tmp") + "/test-validate-" + std::to_string(getpid()) + "-" + std::to_string(index);
+                validator->save(filename, index);
+                delete validator;
+                validator = Json::SchemaValidator::load_file(filename, index, options);
+                unlink(filename.c_str());
+                if (validator == NULL) {
+                    fprintf(stderr, "%s: %u: can't load saved validator\n", prg, index);
+                    return false;
+                }
+            }
         }
     }
     catch (Json::SchemaValidator::Exception e) {
@@ -148,6 +259,65 @@ static bool run_test(const Json::Value &test, unsigned int index) {
         const Json::Value &test_case = tests[i];
         bool valid = validator->validate(test_case["data"]);
         
+        if (cache_size > 0) {
+            // Answered from the cache, must match the first validation.
+            std::vector<Json::SchemaValidator::Error> errors;
+            if (validator->validate(test_case["data"], &errors) != valid || errors.size() != validator->errors().size()) {
+                err++;
+                if (verbose) {
+                    printf("%u.%u %s / %s - cached result differs\n", index, i, test["description"].asCString(), test_case["description"].asCString());
+                }
+            }
+        }
+        
+        if (validator->is_valid(test_case["data"]) != valid) {
+            err++;
+            if (verbose) {
+                printf("%u.%u %s / %s - is_valid disagrees with validate\n", index, i, test["description"].asCString(), test_case["description"].asCString());
+            }
+        }
+        
+        if (use_stream) {
+            // Same errors as validate(), in document order.
+            std::vector<Json::SchemaValidator::Error> errors;
+            Json::StreamValidator stream(*validator, &errors);
+            replay(test_case["data"], &stream);
+            Json::StreamValidator quick(*validator);
+            replay(test_case["data"], &quick);
+            // Duplicate member names count once, like in Json::Reader.
+            Json::StreamValidator repeated(*validator);
+            replay(test_case["data"], &repeated, true);
+            if (!stream.complete() || stream.is_valid() != valid || quick.is_valid() != valid || repeated.is_valid() != valid || !same_errors(errors, validator->errors())) {
+                err++;
+                if (verbose) {
+                    printf("%u.%u %s / %s - streamed result differs\n", index, i, test["description"].asCString(), test_case["description"].asCString());
+                }
+            }
+        }
+
+        if (use_push) {
+            // Same errors as validate(), whether the text arrives at once or byte by byte.
+            Json::StreamWriterBuilder builder;
+            builder["indentation"] = "";
+            auto text = Json::writeString(builder, test_case["data"]);
+            std::vector<Json::SchemaValidator::Error> errors;
+            Json::PushValidator whole(*validator, &errors);
+            whole.feed(text);
+            auto whole_valid = whole.finish();
+            std::vector<Json::SchemaValidator::Error> byte_errors;
+            Json::PushValidator bytes(*validator, &byte_errors);
+            for (size_t k = 0; k < text.length(); k++) {
+                bytes.feed(text.data() + k, 1);
+            }
+            auto bytes_valid = bytes.finish();
+            if (whole_valid != valid || bytes_valid != valid || !same_errors(errors, validator->errors()) || !same_errors(byte_errors, validator->errors())) {
+                err++;
+                if (verbose) {
+                    printf("%u.%u %s / %s - pushed result differs\n", index, i, test["description"].asCString(), test_case["description"].asCString());
+                }
+            }
+        }
+
         if (valid != test_case["valid"].asBool()) {
             err++;
             if (verbose) {
@@ -169,3 +339,55 @@ static bool run_test(const Json::Value &test, unsigned int index) {
     
     return (err == 0);
 }
+
+
+// Reports |value| to |stream| as parser events, with |repeat_members| each member twice.
+static void replay(const Json::Value &value, Json::StreamValidator *stream, bool repeat_members) {
+    switch (value.type()) {
+        case Json::objectValue:
+            stream->start_object();
+            for (auto it = value.begin(); it != value.end(); ++it) {
+                const char *name_end;
+                auto name = it.memberName(&name_end);
+                if (repeat_members) {
+                    // Not repeated within the duplicate, keeping the number of events linear.
+                    stream->key(name, static_cast<size_t>(name_end - name));
+                    replay(*it, stream, false);
+                }
+                stream->key(name, static_cast<size_t>(name_end - name));
+                replay(*it, stream, repeat_members);
+            }
+            stream->end_object();
+            break;
+
+        case Json::arrayValue:
+            stream->start_array();
+            for (const auto &item : value) {
+                replay(item, stream, repeat_members);
+            }
+            stream->end_array();
+            break;
+
+        default:
+            stream->value(value);
+            break;
+    }
+}
+
+
+static bool same_errors(std::vector<Json::SchemaValidator::Error> a, std::vector<Json::SchemaValidator::Error> b) {
+    auto less = [](const Json::SchemaValidator::Error &x, const Json::SchemaValidator::Error &y) {
+        return x.path < y.path || (x.path == y.path && x.message < y.message);
+    };
+    std::sort(a.begin(), a.end(), less);
+    std::sort(b.begin(), b.end(), less);
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i].path != b[i].path || a[i].message != b[i].message) {
+            return false;
+        }
+    }
+    return true;
+}